@@ -0,0 +1,89 @@
+/* arena.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Monotonic allocator implementation.
+*/
+
+#include "reflect.h"
+
+namespace reflect {
+
+/******************************************************************************/
+/* ARENA                                                                      */
+/******************************************************************************/
+
+Arena::
+Arena(size_t blockSize) :
+    blockSize(blockSize), capacity_(0), cur_(nullptr), end_(nullptr)
+{}
+
+Arena::
+~Arena()
+{
+    for (char* block : blocks) delete[] block;
+}
+
+void*
+Arena::
+allocateSlow(size_t size, size_t align)
+{
+    // Oversized allocations get a block of their own which leaves the current
+    // block available for the small allocations that follow.
+    size_t n = size + align - 1;
+    if (n > blockSize / 4 && cur_ != end_) {
+        char* block = new char[n];
+        capacity_ += n;
+        blocks.insert(blocks.end() - 1, block);
+
+        size_t pad = -uintptr_t(block) & (align - 1);
+        return block + pad;
+    }
+
+    n = std::max(n, size_t(blockSize));
+    char* block = new char[n];
+    capacity_ += n;
+    blocks.push_back(block);
+
+    cur_ = block;
+    end_ = block + n;
+    return allocate(size, align);
+}
+
+void
+Arena::
+release()
+{
+    if (blocks.empty()) return;
+
+    // The last block is always the one being carved so it's the one we keep.
+    char* last = blocks.back();
+    for (size_t i = 0; i + 1 < blocks.size(); ++i) delete[] blocks[i];
+
+    blocks.assign(1, last);
+    cur_ = last;
+    capacity_ = end_ - last;
+}
+
+void
+Arena::
+absorb(Arena& other)
+{
+    if (other.blocks.empty()) return;
+
+    // Our current block stays the last one so it keeps being carved.
+    if (blocks.empty()) {
+        std::swap(blocks, other.blocks);
+        cur_ = other.cur_;
+        end_ = other.end_;
+    }
+    else blocks.insert(blocks.end() - 1, other.blocks.begin(), other.blocks.end());
+
+    capacity_ += other.capacity_;
+
+    other.blocks.clear();
+    other.capacity_ = 0;
+    other.cur_ = other.end_ = nullptr;
+}
+
+} // namespace reflect
@@ -0,0 +1,111 @@
+/* arena.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Monotonic allocator.
+
+   Memory is carved out of large blocks and never handed back individually.
+   The json parser only uses it for the pointees of shared pointers, which
+   share a single allocation with their control block through
+   std::allocate_shared and an ArenaAllocator, and for the strings of
+   StringRef fields. std::string, containers, unique_ptr and raw pointees
+   still come from the heap so freeing a parsed value still walks all of it.
+
+   The arena doesn't run destructors so objects must be destroyed before the
+   arena is released or destroyed.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* ARENA                                                                      */
+/******************************************************************************/
+
+struct Arena
+{
+    enum { BlockSize = 64 * 1024 };
+
+    explicit Arena(size_t blockSize = BlockSize);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // align must be a power of 2.
+    void* allocate(size_t size, size_t align)
+    {
+        size_t pad = -uintptr_t(cur_) & (align - 1);
+        if (size + pad <= size_t(end_ - cur_)) {
+            void* ptr = cur_ + pad;
+            cur_ += pad + size;
+            return ptr;
+        }
+        return allocateSlow(size, align);
+    }
+
+    template<typename T>
+    T* allocate(size_t n = 1)
+    {
+        return static_cast<T*>(allocate(n * sizeof(T), alignof(T)));
+    }
+
+    // Frees every block at once except for the current one which is kept
+    // around for the next round of allocations.
+    void release();
+
+    // Takes over the blocks of the other arena which is left empty. Objects
+    // allocated from it must now be destroyed before this arena is released.
+    void absorb(Arena& other);
+
+    // Bytes reserved from the heap.
+    size_t capacity() const { return capacity_; }
+
+private:
+    void* allocateSlow(size_t size, size_t align);
+
+    size_t blockSize;
+    std::vector<char*> blocks;
+    size_t capacity_;
+
+    char* cur_;
+    char* end_;
+};
+
+
+/******************************************************************************/
+/* ARENA ALLOCATOR                                                            */
+/******************************************************************************/
+
+// Standard allocator over an arena where deallocation is a no-op.
+template<typename T>
+struct ArenaAllocator
+{
+    typedef T value_type;
+
+    explicit ArenaAllocator(Arena& arena) : arena(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) { return arena->allocate<T>(n); }
+    void deallocate(T*, size_t) {}
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const
+    {
+        return arena == other.arena;
+    }
+
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const
+    {
+        return arena != other.arena;
+    }
+
+    Arena* arena;
+};
+
+} // namespace reflect
@@ -8,6 +8,7 @@
 #include "reflect.h"
 
 #include <sstream>
+#include <atomic>
 
 namespace reflect {
 
@@ -40,8 +41,25 @@ std::ostream& operator<<(std::ostream& stream, Match match)
 /* ARGUMENT                                                                   */
 /******************************************************************************/
 
+namespace {
+
+// Default constructed arguments are created for every Value so avoid hitting
+// the registry lock each time. A function-local static can't be used here
+// because loading the void type constructs Arguments which would recurse into
+// the static's initialization.
+const Type* voidType()
+{
+    static std::atomic<const Type*> cache(nullptr);
+
+    const Type* type = cache.load(std::memory_order_relaxed);
+    if (!type) cache.store(type = reflect::type<void>(), std::memory_order_relaxed);
+    return type;
+}
+
+} // namespace anonymous
+
 Argument::
-Argument() : type_(reflect::type<void>()) {}
+Argument() : type_(voidType()) {}
 
 Argument::
 Argument(const Type* type, RefType refType, bool isConst) :
@@ -52,7 +70,7 @@ bool
 Argument::
 isVoid() const
 {
-    return type_ == reflect::type<void>();
+    return type_ == voidType();
 }
 
 bool
@@ -16,3 +16,4 @@
 #include "field.h"
 #include "function.h"
 #include "operators.h"
+#include "static.h"
@@ -39,7 +39,19 @@ void reflectParent_(Type* type)
 /* REFLECT POINTER                                                            */
 /******************************************************************************/
 
-#define reflectPointer(pointer, pointee) \
-    type_->setPointer(#pointer, ::reflect::type<pointee>())
+// Specialized alongside the reflection of pointer types to provide direct
+// access to the pointee.
+template<typename T>
+struct PointerTraits
+{
+    static constexpr PointerKind kind = PointerKind::Custom;
+    static constexpr PointerGetter get = nullptr;
+};
+
+#define reflectPointer(pointer, pointee)                        \
+    type_->setPointer(                                          \
+            #pointer, ::reflect::type<pointee>(),               \
+            ::reflect::PointerTraits<T_>::kind,                 \
+            ::reflect::PointerTraits<T_>::get)
 
 } // reflect
@@ -0,0 +1,503 @@
+/* static.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Compile-time reflection.
+
+   Describes the parent, fields and methods of a type through templates so that
+   generic code (serializers, comparators, hashers, ...) can be fully
+   specialized and inlined without ever touching the registry. The description
+   lives at namespace scope and the runtime reflection of the type is populated
+   from it by calling reflectStatic() within the reflectType block:
+
+       reflectStaticTrait(key)
+
+       reflectStaticParent(Foo, Bar)
+       reflectStaticFields(Foo, a, b)
+       reflectStaticMethods(Foo, sum)
+       reflectStaticFieldTraits(Foo, b, key)
+
+       reflectType(Foo) { reflectStatic(); }
+
+   The fields of every instance of a template with a single type parameter are
+   described at once with reflectStaticTemplateFields(Box, T, a, b).
+
+   Static traits are tag types which are also added as valueless traits of the
+   runtime fields. They must be declared before the fields are first walked.
+   Overloaded methods can't be described statically since their address is
+   ambiguous; use reflectFn for those.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* FOR EACH                                                                   */
+/******************************************************************************/
+// Applies m(c, x) to each x of a list of up to 32 arguments; the comma variant
+// separates the expansions with commas.
+
+#define reflectStaticCount(...)                                         \
+    reflectStaticCountImpl(__VA_ARGS__,                                 \
+            32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, \
+            16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+#define reflectStaticCountImpl(                                         \
+        _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, \
+        _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28,  \
+        _29, _30, _31, _32, n, ...) n
+
+#define reflectStaticForEach(m, c, ...)                                 \
+    reflectConcat(reflectStaticEach, reflectStaticCount(__VA_ARGS__))   \
+    (m, c, __VA_ARGS__)
+
+#define reflectStaticForEachComma(m, c, ...)                            \
+    reflectConcat(reflectStaticComma, reflectStaticCount(__VA_ARGS__))  \
+    (m, c, __VA_ARGS__)
+
+#define reflectStaticEach1(m, c, x) m(c, x)
+#define reflectStaticEach2(m, c, x, ...) m(c, x) reflectStaticEach1(m, c, __VA_ARGS__)
+#define reflectStaticEach3(m, c, x, ...) m(c, x) reflectStaticEach2(m, c, __VA_ARGS__)
+#define reflectStaticEach4(m, c, x, ...) m(c, x) reflectStaticEach3(m, c, __VA_ARGS__)
+#define reflectStaticEach5(m, c, x, ...) m(c, x) reflectStaticEach4(m, c, __VA_ARGS__)
+#define reflectStaticEach6(m, c, x, ...) m(c, x) reflectStaticEach5(m, c, __VA_ARGS__)
+#define reflectStaticEach7(m, c, x, ...) m(c, x) reflectStaticEach6(m, c, __VA_ARGS__)
+#define reflectStaticEach8(m, c, x, ...) m(c, x) reflectStaticEach7(m, c, __VA_ARGS__)
+#define reflectStaticEach9(m, c, x, ...) m(c, x) reflectStaticEach8(m, c, __VA_ARGS__)
+#define reflectStaticEach10(m, c, x, ...) m(c, x) reflectStaticEach9(m, c, __VA_ARGS__)
+#define reflectStaticEach11(m, c, x, ...) m(c, x) reflectStaticEach10(m, c, __VA_ARGS__)
+#define reflectStaticEach12(m, c, x, ...) m(c, x) reflectStaticEach11(m, c, __VA_ARGS__)
+#define reflectStaticEach13(m, c, x, ...) m(c, x) reflectStaticEach12(m, c, __VA_ARGS__)
+#define reflectStaticEach14(m, c, x, ...) m(c, x) reflectStaticEach13(m, c, __VA_ARGS__)
+#define reflectStaticEach15(m, c, x, ...) m(c, x) reflectStaticEach14(m, c, __VA_ARGS__)
+#define reflectStaticEach16(m, c, x, ...) m(c, x) reflectStaticEach15(m, c, __VA_ARGS__)
+#define reflectStaticEach17(m, c, x, ...) m(c, x) reflectStaticEach16(m, c, __VA_ARGS__)
+#define reflectStaticEach18(m, c, x, ...) m(c, x) reflectStaticEach17(m, c, __VA_ARGS__)
+#define reflectStaticEach19(m, c, x, ...) m(c, x) reflectStaticEach18(m, c, __VA_ARGS__)
+#define reflectStaticEach20(m, c, x, ...) m(c, x) reflectStaticEach19(m, c, __VA_ARGS__)
+#define reflectStaticEach21(m, c, x, ...) m(c, x) reflectStaticEach20(m, c, __VA_ARGS__)
+#define reflectStaticEach22(m, c, x, ...) m(c, x) reflectStaticEach21(m, c, __VA_ARGS__)
+#define reflectStaticEach23(m, c, x, ...) m(c, x) reflectStaticEach22(m, c, __VA_ARGS__)
+#define reflectStaticEach24(m, c, x, ...) m(c, x) reflectStaticEach23(m, c, __VA_ARGS__)
+#define reflectStaticEach25(m, c, x, ...) m(c, x) reflectStaticEach24(m, c, __VA_ARGS__)
+#define reflectStaticEach26(m, c, x, ...) m(c, x) reflectStaticEach25(m, c, __VA_ARGS__)
+#define reflectStaticEach27(m, c, x, ...) m(c, x) reflectStaticEach26(m, c, __VA_ARGS__)
+#define reflectStaticEach28(m, c, x, ...) m(c, x) reflectStaticEach27(m, c, __VA_ARGS__)
+#define reflectStaticEach29(m, c, x, ...) m(c, x) reflectStaticEach28(m, c, __VA_ARGS__)
+#define reflectStaticEach30(m, c, x, ...) m(c, x) reflectStaticEach29(m, c, __VA_ARGS__)
+#define reflectStaticEach31(m, c, x, ...) m(c, x) reflectStaticEach30(m, c, __VA_ARGS__)
+#define reflectStaticEach32(m, c, x, ...) m(c, x) reflectStaticEach31(m, c, __VA_ARGS__)
+
+#define reflectStaticComma1(m, c, x) m(c, x)
+#define reflectStaticComma2(m, c, x, ...) m(c, x), reflectStaticComma1(m, c, __VA_ARGS__)
+#define reflectStaticComma3(m, c, x, ...) m(c, x), reflectStaticComma2(m, c, __VA_ARGS__)
+#define reflectStaticComma4(m, c, x, ...) m(c, x), reflectStaticComma3(m, c, __VA_ARGS__)
+#define reflectStaticComma5(m, c, x, ...) m(c, x), reflectStaticComma4(m, c, __VA_ARGS__)
+#define reflectStaticComma6(m, c, x, ...) m(c, x), reflectStaticComma5(m, c, __VA_ARGS__)
+#define reflectStaticComma7(m, c, x, ...) m(c, x), reflectStaticComma6(m, c, __VA_ARGS__)
+#define reflectStaticComma8(m, c, x, ...) m(c, x), reflectStaticComma7(m, c, __VA_ARGS__)
+#define reflectStaticComma9(m, c, x, ...) m(c, x), reflectStaticComma8(m, c, __VA_ARGS__)
+#define reflectStaticComma10(m, c, x, ...) m(c, x), reflectStaticComma9(m, c, __VA_ARGS__)
+#define reflectStaticComma11(m, c, x, ...) m(c, x), reflectStaticComma10(m, c, __VA_ARGS__)
+#define reflectStaticComma12(m, c, x, ...) m(c, x), reflectStaticComma11(m, c, __VA_ARGS__)
+#define reflectStaticComma13(m, c, x, ...) m(c, x), reflectStaticComma12(m, c, __VA_ARGS__)
+#define reflectStaticComma14(m, c, x, ...) m(c, x), reflectStaticComma13(m, c, __VA_ARGS__)
+#define reflectStaticComma15(m, c, x, ...) m(c, x), reflectStaticComma14(m, c, __VA_ARGS__)
+#define reflectStaticComma16(m, c, x, ...) m(c, x), reflectStaticComma15(m, c, __VA_ARGS__)
+#define reflectStaticComma17(m, c, x, ...) m(c, x), reflectStaticComma16(m, c, __VA_ARGS__)
+#define reflectStaticComma18(m, c, x, ...) m(c, x), reflectStaticComma17(m, c, __VA_ARGS__)
+#define reflectStaticComma19(m, c, x, ...) m(c, x), reflectStaticComma18(m, c, __VA_ARGS__)
+#define reflectStaticComma20(m, c, x, ...) m(c, x), reflectStaticComma19(m, c, __VA_ARGS__)
+#define reflectStaticComma21(m, c, x, ...) m(c, x), reflectStaticComma20(m, c, __VA_ARGS__)
+#define reflectStaticComma22(m, c, x, ...) m(c, x), reflectStaticComma21(m, c, __VA_ARGS__)
+#define reflectStaticComma23(m, c, x, ...) m(c, x), reflectStaticComma22(m, c, __VA_ARGS__)
+#define reflectStaticComma24(m, c, x, ...) m(c, x), reflectStaticComma23(m, c, __VA_ARGS__)
+#define reflectStaticComma25(m, c, x, ...) m(c, x), reflectStaticComma24(m, c, __VA_ARGS__)
+#define reflectStaticComma26(m, c, x, ...) m(c, x), reflectStaticComma25(m, c, __VA_ARGS__)
+#define reflectStaticComma27(m, c, x, ...) m(c, x), reflectStaticComma26(m, c, __VA_ARGS__)
+#define reflectStaticComma28(m, c, x, ...) m(c, x), reflectStaticComma27(m, c, __VA_ARGS__)
+#define reflectStaticComma29(m, c, x, ...) m(c, x), reflectStaticComma28(m, c, __VA_ARGS__)
+#define reflectStaticComma30(m, c, x, ...) m(c, x), reflectStaticComma29(m, c, __VA_ARGS__)
+#define reflectStaticComma31(m, c, x, ...) m(c, x), reflectStaticComma30(m, c, __VA_ARGS__)
+#define reflectStaticComma32(m, c, x, ...) m(c, x), reflectStaticComma31(m, c, __VA_ARGS__)
+
+
+/******************************************************************************/
+/* STATIC TRAITS                                                              */
+/******************************************************************************/
+
+namespace tags {}
+
+#define reflectStaticTrait(trait)                                       \
+    namespace reflect { namespace tags {                                \
+    struct trait                                                        \
+    {                                                                   \
+        static constexpr const char* name() { return #trait; }          \
+    };                                                                  \
+    }} // namespace reflect::tags
+
+// Keyed on the member pointer so that the traits can be declared separately
+// from the field list.
+template<typename M, M Ptr>
+struct StaticFieldTraits
+{
+    typedef TypeVector<> type;
+};
+
+#define reflectStaticTraitTag(c, trait) ::reflect::tags::trait
+
+#define reflectStaticFieldTraits(T, f, ...)                             \
+    namespace reflect {                                                 \
+    template<>                                                          \
+    struct StaticFieldTraits<decltype(&T::f), &T::f>                    \
+    {                                                                   \
+        typedef TypeVector<                                             \
+            reflectStaticForEachComma(reflectStaticTraitTag, _, __VA_ARGS__) \
+            > type;                                                     \
+    };                                                                  \
+    } // namespace reflect
+
+
+/******************************************************************************/
+/* STATIC FIELD                                                               */
+/******************************************************************************/
+
+template<typename T, typename F, F T::* Ptr, typename Name>
+struct StaticField
+{
+    typedef T owner;
+    typedef F type;
+    typedef typename StaticFieldTraits<F T::*, Ptr>::type traits;
+
+    static constexpr const char* name() { return Name::value(); }
+    static constexpr F T::* pointer() { return Ptr; }
+
+    static F& get(T& obj) { return obj.*Ptr; }
+    static const F& get(const T& obj) { return obj.*Ptr; }
+
+    static size_t offset()
+    {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        const T* obj = reinterpret_cast<const T*>(&storage);
+
+        return  reinterpret_cast<const char*>(&(obj->*Ptr)) -
+                reinterpret_cast<const char*>(obj);
+    }
+};
+
+template<typename T>
+struct StaticFields
+{
+    static constexpr bool reflected = false;
+    typedef TypeVector<> type;
+};
+
+#define reflectStaticName(T, x)                                         \
+    struct reflectConcat(name_, x)                                      \
+    {                                                                   \
+        static constexpr const char* value() { return #x; }             \
+    };
+
+#define reflectStaticFieldEntry(T, f)                                   \
+    ::reflect::StaticField<T, decltype(T::f), &T::f, reflectConcat(name_, f)>
+
+#define reflectStaticFields(T, ...)                                     \
+    namespace reflect {                                                 \
+    template<>                                                          \
+    struct StaticFields<T>                                              \
+    {                                                                   \
+        static constexpr bool reflected = true;                         \
+        reflectStaticForEach(reflectStaticName, T, __VA_ARGS__)         \
+        typedef TypeVector<                                             \
+            reflectStaticForEachComma(reflectStaticFieldEntry, T, __VA_ARGS__) \
+            > type;                                                     \
+    };                                                                  \
+    } // namespace reflect
+
+#define reflectStaticTemplateFields(temp, arg, ...)                     \
+    namespace reflect {                                                 \
+    template<typename arg>                                              \
+    struct StaticFields< temp<arg> >                                    \
+    {                                                                   \
+        typedef temp<arg> Owner;                                        \
+        static constexpr bool reflected = true;                         \
+        reflectStaticForEach(reflectStaticName, Owner, __VA_ARGS__)     \
+        typedef TypeVector<                                             \
+            reflectStaticForEachComma(reflectStaticFieldEntry, Owner, __VA_ARGS__) \
+            > type;                                                     \
+    };                                                                  \
+    } // namespace reflect
+
+
+/******************************************************************************/
+/* STATIC METHOD                                                              */
+/******************************************************************************/
+
+template<typename T, typename Fn, Fn Ptr, typename Name>
+struct StaticMethod
+{
+    typedef T owner;
+    typedef Fn type;
+
+    static constexpr const char* name() { return Name::value(); }
+    static constexpr Fn pointer() { return Ptr; }
+
+    template<typename Obj, typename... Args>
+    static auto call(Obj&& obj, Args&&... args) ->
+        decltype((std::forward<Obj>(obj).*Ptr)(std::forward<Args>(args)...))
+    {
+        return (std::forward<Obj>(obj).*Ptr)(std::forward<Args>(args)...);
+    }
+};
+
+template<typename T>
+struct StaticMethods
+{
+    typedef TypeVector<> type;
+};
+
+#define reflectStaticMethodEntry(T, fn)                                 \
+    ::reflect::StaticMethod<                                            \
+        T, decltype(&T::fn), &T::fn, reflectConcat(name_, fn)>
+
+#define reflectStaticMethods(T, ...)                                    \
+    namespace reflect {                                                 \
+    template<>                                                          \
+    struct StaticMethods<T>                                             \
+    {                                                                   \
+        reflectStaticForEach(reflectStaticName, T, __VA_ARGS__)         \
+        typedef TypeVector<                                             \
+            reflectStaticForEachComma(reflectStaticMethodEntry, T, __VA_ARGS__) \
+            > type;                                                     \
+    };                                                                  \
+    } // namespace reflect
+
+
+/******************************************************************************/
+/* STATIC PARENT                                                              */
+/******************************************************************************/
+
+template<typename T>
+struct StaticParent
+{
+    typedef void type;
+};
+
+#define reflectStaticParent(T, P)                                       \
+    namespace reflect {                                                 \
+    template<>                                                          \
+    struct StaticParent<T>                                              \
+    {                                                                   \
+        static_assert(std::is_base_of<P, T>::value, "invalid parent");  \
+        typedef P type;                                                 \
+    };                                                                  \
+    } // namespace reflect
+
+
+/******************************************************************************/
+/* FOR EACH FIELD                                                             */
+/******************************************************************************/
+
+namespace details {
+
+template<typename Left, typename Right> struct StaticConcat;
+
+template<typename... Left, typename... Right>
+struct StaticConcat< TypeVector<Left...>, TypeVector<Right...> >
+{
+    typedef TypeVector<Left..., Right...> type;
+};
+
+// Flattens the list of a type and all its parents, parents first.
+template<typename T, template<typename> class List,
+         typename P = typename StaticParent<T>::type>
+struct StaticAll
+{
+    typedef typename StaticConcat<
+        typename StaticAll<P, List>::type,
+        typename List<T>::type>::type type;
+};
+
+template<typename T, template<typename> class List>
+struct StaticAll<T, List, void>
+{
+    typedef typename List<T>::type type;
+};
+
+template<typename Fn>
+void staticForEach(TypeVector<>, Fn&) {}
+
+template<typename Head, typename... Tail, typename Fn>
+void staticForEach(TypeVector<Head, Tail...>, Fn& fn)
+{
+    fn(Head());
+    staticForEach(TypeVector<Tail...>(), fn);
+}
+
+} // namespace details
+
+template<typename T>
+struct AllStaticFields
+{
+    typedef typename details::StaticAll<T, StaticFields>::type type;
+};
+
+template<typename T>
+struct AllStaticMethods
+{
+    typedef typename details::StaticAll<T, StaticMethods>::type type;
+};
+
+// Calls fn(Field()) for each field descriptor of T and its parents.
+template<typename T, typename Fn>
+Fn forEachField(Fn fn)
+{
+    details::staticForEach(typename AllStaticFields<T>::type(), fn);
+    return fn;
+}
+
+// Calls fn(Method()) for each method descriptor of T and its parents.
+template<typename T, typename Fn>
+Fn forEachMethod(Fn fn)
+{
+    details::staticForEach(typename AllStaticMethods<T>::type(), fn);
+    return fn;
+}
+
+namespace details {
+
+template<typename Trait, typename List> struct StaticContains;
+
+template<typename Trait>
+struct StaticContains< Trait, TypeVector<> > : public std::false_type {};
+
+template<typename Trait, typename Head, typename... Tail>
+struct StaticContains< Trait, TypeVector<Head, Tail...> > :
+        public std::integral_constant<bool,
+            std::is_same<Trait, Head>::value ||
+            StaticContains< Trait, TypeVector<Tail...> >::value>
+{};
+
+} // namespace details
+
+template<typename Field, typename Trait>
+struct HasStaticTrait :
+        public details::StaticContains<Trait, typename Field::traits>
+{};
+
+
+/******************************************************************************/
+/* ALGORITHMS                                                                 */
+/******************************************************************************/
+
+namespace details {
+
+template<typename T>
+struct StaticEqual
+{
+    const T& lhs;
+    const T& rhs;
+    bool result;
+
+    template<typename Field>
+    void operator() (Field)
+    {
+        result = result && Field::get(lhs) == Field::get(rhs);
+    }
+};
+
+template<typename T>
+struct StaticHash
+{
+    const T& value;
+    size_t result;
+
+    template<typename Field>
+    void operator() (Field)
+    {
+        typedef typename std::decay<typename Field::type>::type F;
+        size_t hash = std::hash<F>()(Field::get(value));
+        result ^= hash + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+};
+
+} // namespace details
+
+template<typename T>
+bool staticEqual(const T& lhs, const T& rhs)
+{
+    return forEachField<T>(details::StaticEqual<T>{ lhs, rhs, true }).result;
+}
+
+template<typename T>
+size_t staticHash(const T& value)
+{
+    return forEachField<T>(details::StaticHash<T>{ value, 0 }).result;
+}
+
+
+/******************************************************************************/
+/* REFLECT STATIC                                                             */
+/******************************************************************************/
+
+namespace details {
+
+struct StaticRegisterField
+{
+    Type* type;
+
+    void addTraits(Field&, TypeVector<>) {}
+
+    template<typename Trait, typename... Rest>
+    void addTraits(Field& field, TypeVector<Trait, Rest...>)
+    {
+        field.addTrait(Trait::name());
+        addTraits(field, TypeVector<Rest...>());
+    }
+
+    template<typename F>
+    void operator() (F)
+    {
+        type->addField<typename F::type>(F::name(), F::offset());
+        addTraits(type->field(F::name()), typename F::traits());
+    }
+};
+
+struct StaticRegisterMethod
+{
+    Type* type;
+
+    template<typename M>
+    void operator() (M)
+    {
+        type->addFunction(M::name(), M::pointer());
+    }
+};
+
+template<typename P>
+void staticParent(Type* type, P*) { reflectParent_<P>(type); }
+inline void staticParent(Type*, void*) {}
+
+} // namespace details
+
+// Only registers the members of T itself; the parent's members are reflected
+// by the parent's own reflection.
+template<typename T>
+void reflectStatic_(Type* type)
+{
+    typedef typename StaticParent<T>::type P;
+    details::staticParent(type, static_cast<P*>(nullptr));
+
+    details::StaticRegisterField fields{ type };
+    details::staticForEach(typename StaticFields<T>::type(), fields);
+
+    details::StaticRegisterMethod methods{ type };
+    details::staticForEach(typename StaticMethods<T>::type(), methods);
+}
+
+#define reflectStatic()                         \
+    ::reflect::reflectStatic_<T_>(type_)
+
+} // reflect
@@ -54,6 +54,11 @@ struct Function
     template<typename Ret, typename... Args>
     Ret call(Args&&... args) const;
 
+    // Same as call but skips the signature check. Only safe to use when the
+    // arguments were already tested via testParams.
+    template<typename Ret, typename... Args>
+    Ret invoke(Args&&... args) const;
+
 private:
 
     Match test(const Argument& value, const Argument& target) const;
@@ -162,6 +162,14 @@ call(Args&&... args) const
                 signature<Ret(Args...)>(), signature(*this));
     }
 
+    return invoke<Ret>(std::forward<Args>(args)...);
+}
+
+template<typename Ret, typename... Args>
+Ret
+Function::
+invoke(Args&&... args) const
+{
     typedef ValueFunction<sizeof...(Args)> Fn;
     Fn& typedFn = *static_cast<Fn*>(fn);
 
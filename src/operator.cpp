@@ -0,0 +1,96 @@
+/* operator.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Operator enum implementation.
+*/
+
+#include "reflect.h"
+
+namespace reflect {
+
+/******************************************************************************/
+/* OPERATOR                                                                   */
+/******************************************************************************/
+
+namespace {
+
+const char* operatorNames[] =
+{
+    "operator=",
+
+    "operator+=",
+    "operator-=",
+    "operator*=",
+    "operator/=",
+    "operator%=",
+    "operator&=",
+    "operator|=",
+    "operator^=",
+    "operator<<=",
+    "operator>>=",
+
+    "operator++",
+    "operator--",
+
+    "operator+",
+    "operator-",
+    "operator*",
+    "operator/",
+    "operator%",
+    "operator~",
+    "operator&",
+    "operator|",
+    "operator^",
+    "operator<<",
+    "operator>>",
+
+    "operator!",
+    "operator&&",
+    "operator||",
+
+    "operator==",
+    "operator!=",
+    "operator<",
+    "operator>",
+    "operator<=",
+    "operator>=",
+
+    "operator()",
+    "operator[]",
+    "operator bool()",
+};
+
+static_assert(
+        sizeof(operatorNames) / sizeof(operatorNames[0]) ==
+        size_t(Operator::Size),
+        "operator name table is out of sync with the Operator enum");
+
+} // namespace anonymous
+
+
+const char* operatorName(Operator op)
+{
+    if (op >= Operator::Size) reflectError("unknown operator value");
+    return operatorNames[size_t(op)];
+}
+
+Operator operatorId(const std::string& name)
+{
+    static const std::unordered_map<std::string, Operator> ids = [] {
+        std::unordered_map<std::string, Operator> ids;
+        for (size_t i = 0; i < size_t(Operator::Size); ++i)
+            ids.emplace(operatorNames[i], Operator(i));
+        return ids;
+    }();
+
+    auto it = ids.find(name);
+    return it != ids.end() ? it->second : Operator::Size;
+}
+
+std::ostream& operator<<(std::ostream& stream, Operator op)
+{
+    return stream << operatorName(op);
+}
+
+} // reflect
@@ -0,0 +1,79 @@
+/* operator.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Enum of the overloadable operators.
+
+   Operators are registered as regular functions under their usual names
+   (operator+, operator bool(), ...) but they're also indexed in a fixed table
+   on the Type so that Value's operators don't need to do a name lookup. Each
+   entry maps to a function name and not a signature so overloads that share a
+   name (unary and binary operator* or prefix and postfix operator++) share an
+   entry.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* OPERATOR                                                                   */
+/******************************************************************************/
+
+enum struct Operator
+{
+    Assign,
+
+    PlusAssign,
+    MinusAssign,
+    MultAssign,
+    DivAssign,
+    ModAssign,
+    BitAndAssign,
+    BitOrAssign,
+    BitXorAssign,
+    BitLShiftAssign,
+    BitRShiftAssign,
+
+    Inc,
+    Dec,
+
+    Plus,
+    Minus,
+    Mult,
+    Div,
+    Mod,
+    BitNot,
+    BitAnd,
+    BitOr,
+    BitXor,
+    BitLShift,
+    BitRShift,
+
+    LogicNot,
+    LogicAnd,
+    LogicOr,
+
+    EqComp,
+    NEComp,
+    LTComp,
+    GTComp,
+    LEComp,
+    GEComp,
+
+    Function,
+    Array,
+    Bool,
+
+    Size
+};
+
+const char* operatorName(Operator op);
+
+// Returns Operator::Size if the name isn't an indexed operator.
+Operator operatorId(const std::string& name);
+
+std::ostream& operator<<(std::ostream& stream, Operator op);
+
+} // reflect
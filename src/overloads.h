@@ -37,9 +37,16 @@ struct Overloads : public Traits
     template<typename Ret, typename... Args>
     Ret call(Args&&... args) const;
 
+    template<typename Ret, typename... Args>
+    Result<Ret> tryCall(Args&&... args) const;
+
     std::string print(size_t indent = 0) const;
 
 private:
+
+    template<typename Ret, typename... Args>
+    const Function* resolve(Status& status, Args&&... args) const;
+
     std::vector<Function> overloads;
 };
 
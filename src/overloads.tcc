@@ -40,9 +40,9 @@ get() const
 }
 
 template<typename Ret, typename... Args>
-Ret
+const Function*
 Overloads::
-call(Args&&... args) const
+resolve(Status& status, Args&&... args) const
 {
     const Function* bestFn = nullptr;
     bool ambiguous = false;
@@ -65,7 +65,22 @@ call(Args&&... args) const
         }
     }
 
-    if (!bestFn) {
+    if (!bestFn) status = Status::NoOverload;
+    else if (ambiguous) status = Status::Ambiguous;
+    else status = Status::Ok;
+
+    return status == Status::Ok ? bestFn : nullptr;
+}
+
+template<typename Ret, typename... Args>
+Ret
+Overloads::
+call(Args&&... args) const
+{
+    Status status;
+    const Function* fn = resolve<Ret>(status, std::forward<Args>(args)...);
+
+    if (status == Status::NoOverload) {
         reflectError("no overload <%s> available for function <%s>",
                 signature(
                         Argument::make<Ret>(),
@@ -73,7 +88,7 @@ call(Args&&... args) const
                 name());
     }
 
-    if (ambiguous) {
+    if (status == Status::Ambiguous) {
         reflectError("ambiguous function call <%s> for function <%s>",
                 signature(
                         Argument::make<Ret>(),
@@ -81,7 +96,53 @@ call(Args&&... args) const
                 name());
     }
 
-    return bestFn->call<Ret>(std::forward<Args>(args)...);
+    return fn->invoke<Ret>(std::forward<Args>(args)...);
+}
+
+
+/******************************************************************************/
+/* TRY CALL                                                                   */
+/******************************************************************************/
+
+namespace details {
+
+template<typename Ret>
+struct TryInvoke
+{
+    template<typename... Args>
+    static Result<Ret> invoke(const Function& fn, Args&&... args)
+    {
+        return fn.invoke<Ret>(std::forward<Args>(args)...);
+    }
+};
+
+template<>
+struct TryInvoke<void>
+{
+    template<typename... Args>
+    static Result<void> invoke(const Function& fn, Args&&... args)
+    {
+        fn.invoke<void>(std::forward<Args>(args)...);
+        return Result<void>();
+    }
+};
+
+} // namespace details
+
+template<typename Ret, typename... Args>
+Result<Ret>
+Overloads::
+tryCall(Args&&... args) const
+{
+    Status status;
+    const Function* fn = resolve<Ret>(status, std::forward<Args>(args)...);
+
+    if (!fn) {
+        return Failure::overload<Ret>(
+                status, name(), std::forward<Args>(args)...);
+    }
+
+    return details::TryInvoke<Ret>::invoke(*fn, std::forward<Args>(args)...);
 }
 
 } // reflect
@@ -11,12 +11,15 @@
 #include "ref_type.cpp"
 
 #include "registry.cpp"
+#include "operator.cpp"
 #include "argument.cpp"
 #include "traits.cpp"
 #include "value.cpp"
+#include "result.cpp"
 #include "value_function.cpp"
 #include "scope.cpp"
 #include "type.cpp"
 #include "field.cpp"
 #include "function.cpp"
 #include "overloads.cpp"
+#include "arena.cpp"
@@ -23,6 +23,7 @@
 #include <unordered_set>
 #include <stdexcept>
 #include <cstddef>
+#include <atomic>
 
 #include <iostream> // used only in print functions.
 
@@ -41,12 +42,16 @@ struct Value;
 struct Field;
 struct Function;
 struct Overloads;
+template<typename T> struct Result;
 
 } // namespace reflect
 
 #include "registry.h"
+#include "operator.h"
+#include "type_kind.h"
 #include "argument.h"
 #include "value.h"
+#include "result.h"
 #include "traits.h"
 #include "cast.h"
 #include "value_function.h"
@@ -55,10 +60,12 @@ struct Overloads;
 #include "overloads.h"
 #include "type.h"
 #include "scope.h"
+#include "arena.h"
 
 #include "traits.tcc"
 #include "argument.tcc"
 #include "value.tcc"
+#include "result.tcc"
 #include "field.tcc"
 #include "function.tcc"
 #include "overloads.tcc"
@@ -69,3 +76,4 @@ struct Overloads;
 
 #include "types/primitives.h"
 #include "types/reflect/value.h"
+#include "types/reflect/arena.h"
@@ -0,0 +1,126 @@
+/* result.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Result implementation.
+*/
+
+#include "reflect.h"
+
+#include <sstream>
+
+namespace reflect {
+
+/******************************************************************************/
+/* STATUS                                                                     */
+/******************************************************************************/
+
+std::ostream& operator<<(std::ostream& stream, Status status)
+{
+    switch(status)
+    {
+    case Status::Ok:          stream << "Ok"; break;
+    case Status::NotCastable: stream << "NotCastable"; break;
+    case Status::NoFunction:  stream << "NoFunction"; break;
+    case Status::NoField:     stream << "NoField"; break;
+    case Status::NoOverload:  stream << "NoOverload"; break;
+    case Status::Ambiguous:   stream << "Ambiguous"; break;
+    default: reflectError("unknown status value");
+    };
+
+    return stream;
+}
+
+
+/******************************************************************************/
+/* FAILURE                                                                    */
+/******************************************************************************/
+
+Failure
+Failure::
+cast(const Argument& value, const Argument& target)
+{
+    Failure failure;
+    failure.status_ = Status::NotCastable;
+    failure.setArgument(0, target);
+    failure.addArgument(value);
+    return failure;
+}
+
+Failure
+Failure::
+function(const Type* type, const std::string& name)
+{
+    Failure failure;
+    failure.status_ = Status::NoFunction;
+    failure.type_ = type;
+    failure.name = name;
+    return failure;
+}
+
+Failure
+Failure::
+field(const Type* type, const std::string& name)
+{
+    Failure failure;
+    failure.status_ = Status::NoField;
+    failure.type_ = type;
+    failure.name = name;
+    return failure;
+}
+
+void
+Failure::
+addArgument(const Argument& arg)
+{
+    if (argc < MaxArgs) setArgument(argc + 1, arg);
+    argc++;
+}
+
+std::string
+Failure::
+what() const
+{
+    auto printSignature = [&] {
+        std::stringstream ss;
+
+        ss << argument(0).print() << "(";
+        for (size_t i = 0; i < argc; ++i) {
+            if (i) ss << ", ";
+            if (i == MaxArgs) { ss << "..."; break; }
+            ss << argument(i + 1).print();
+        }
+        ss << ")";
+
+        return ss.str();
+    };
+
+    switch (status_)
+    {
+    case Status::Ok: return "";
+
+    case Status::NotCastable:
+        return errorFormat("<%s> is not castable to <%s>",
+                argument(1).print(), argument(0).print());
+
+    case Status::NoFunction:
+        return errorFormat("<%s> doesn't have a function <%s>",
+                type_->id(), name);
+
+    case Status::NoField:
+        return errorFormat("<%s> doesn't have a field <%s>",
+                type_->id(), name);
+
+    case Status::NoOverload:
+        return errorFormat("no overload <%s> available for function <%s>",
+                printSignature(), name);
+
+    case Status::Ambiguous:
+        return errorFormat("ambiguous function call <%s> for function <%s>",
+                printSignature(), name);
+
+    default: reflectError("unknown status value");
+    }
+}
+
+} // reflect
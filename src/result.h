@@ -0,0 +1,172 @@
+/* result.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Exception-free result of a reflected operation.
+
+   The try* family of functions (tryCast, tryCall, tryField, ...) report their
+   failures through a Result instead of reflectError. A failure only records
+   the raw ingredients of its diagnostic (types, arguments and names) and the
+   message is formatted the first time someone calls what(). Speculative probes
+   that fail often therefore never pay for the string formatting.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* STATUS                                                                     */
+/******************************************************************************/
+
+enum struct Status
+{
+    Ok,
+    NotCastable,
+    NoFunction,
+    NoField,
+    NoOverload,
+    Ambiguous,
+};
+
+std::ostream& operator<<(std::ostream& stream, Status status);
+
+
+/******************************************************************************/
+/* FAILURE                                                                    */
+/******************************************************************************/
+
+struct Failure
+{
+    // Argument lists longer then this are truncated in the diagnostic.
+    enum { MaxArgs = 6 };
+
+    Failure() : status_(Status::Ok), type_(nullptr), argc(0) {}
+
+    static Failure cast(const Argument& value, const Argument& target);
+    static Failure function(const Type* type, const std::string& name);
+    static Failure field(const Type* type, const std::string& name);
+
+    template<typename Ret, typename... Args>
+    static Failure overload(Status status, const std::string& name, Args&&... args);
+
+    Status status() const { return status_; }
+    std::string what() const;
+
+private:
+
+    // Arguments are trivial so we keep them in raw storage to avoid having to
+    // default construct the whole array every time a Result is created.
+    typedef typename std::aligned_storage<
+        sizeof(Argument), alignof(Argument)>::type ArgumentStorage;
+
+    const Argument& argument(size_t i) const
+    {
+        return *reinterpret_cast<const Argument*>(&args[i]);
+    }
+
+    void setArgument(size_t i, const Argument& arg)
+    {
+        new (&args[i]) Argument(arg);
+    }
+
+    void addArguments() {}
+
+    template<typename... Rest>
+    void addArguments(const Value& value, Rest&&... rest);
+
+    template<typename... Rest>
+    void addArguments(Value& value, Rest&&... rest);
+
+    template<typename... Rest>
+    void addArguments(Value&& value, Rest&&... rest);
+
+    template<typename Arg, typename... Rest>
+    void addArguments(Arg&& arg, Rest&&... rest);
+
+    void addArgument(const Argument& arg);
+
+    Status status_;
+    const Type* type_;
+    std::string name;
+
+    // args[0] holds either the return type or the cast target.
+    ArgumentStorage args[MaxArgs + 1];
+    size_t argc;
+};
+
+
+/******************************************************************************/
+/* RESULT                                                                     */
+/******************************************************************************/
+
+template<typename T>
+struct Result
+{
+    Result(T value) : ok_(true) { new (&value_) T(std::move(value)); }
+    Result(Failure failure) : ok_(false), failure_(std::move(failure)) {}
+
+    Result(const Result& other);
+    Result(Result&& other);
+    Result& operator=(Result other);
+    ~Result() { if (ok_) value_.~T(); }
+
+    bool ok() const { return ok_; }
+    explicit operator bool() const { return ok_; }
+
+    Status status() const { return failure_.status(); }
+    const Failure& failure() const { return failure_; }
+    std::string what() const { return failure_.what(); }
+
+    // Raises the recorded failure through reflectError if there's no value.
+    T& value();
+    const T& value() const;
+
+private:
+    bool ok_;
+    union { T value_; };
+    Failure failure_;
+};
+
+template<typename T>
+struct Result<T&>
+{
+    Result(T& value) : value_(&value) {}
+    Result(Failure failure) : value_(nullptr), failure_(std::move(failure)) {}
+
+    bool ok() const { return value_; }
+    explicit operator bool() const { return ok(); }
+
+    Status status() const { return failure_.status(); }
+    const Failure& failure() const { return failure_; }
+    std::string what() const { return failure_.what(); }
+
+    T& value() const;
+
+private:
+    T* value_;
+    Failure failure_;
+};
+
+template<>
+struct Result<void>
+{
+    Result() : ok_(true) {}
+    Result(Failure failure) : ok_(false), failure_(std::move(failure)) {}
+
+    bool ok() const { return ok_; }
+    explicit operator bool() const { return ok_; }
+
+    Status status() const { return failure_.status(); }
+    const Failure& failure() const { return failure_; }
+    std::string what() const { return failure_.what(); }
+
+    void value() const;
+
+private:
+    bool ok_;
+    Failure failure_;
+};
+
+} // reflect
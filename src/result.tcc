@@ -0,0 +1,137 @@
+/* result.tcc                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Template implementation of Result.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* FAILURE                                                                    */
+/******************************************************************************/
+
+template<typename Ret, typename... Args>
+Failure
+Failure::
+overload(Status status, const std::string& name, Args&&... args)
+{
+    Failure failure;
+    failure.status_ = status;
+    failure.name = name;
+
+    failure.setArgument(0, Argument::make<Ret>());
+    failure.addArguments(std::forward<Args>(args)...);
+
+    return failure;
+}
+
+template<typename... Rest>
+void
+Failure::
+addArguments(const Value& value, Rest&&... rest)
+{
+    addArgument(value.argument());
+    addArguments(std::forward<Rest>(rest)...);
+}
+
+template<typename... Rest>
+void
+Failure::
+addArguments(Value& value, Rest&&... rest)
+{
+    addArgument(value.argument());
+    addArguments(std::forward<Rest>(rest)...);
+}
+
+template<typename... Rest>
+void
+Failure::
+addArguments(Value&& value, Rest&&... rest)
+{
+    addArgument(value.argument());
+    addArguments(std::forward<Rest>(rest)...);
+}
+
+template<typename Arg, typename... Rest>
+void
+Failure::
+addArguments(Arg&& arg, Rest&&... rest)
+{
+    addArgument(Argument::make(std::forward<Arg>(arg)));
+    addArguments(std::forward<Rest>(rest)...);
+}
+
+
+/******************************************************************************/
+/* RESULT                                                                     */
+/******************************************************************************/
+
+template<typename T>
+Result<T>::
+Result(const Result& other) :
+    ok_(other.ok_), failure_(other.failure_)
+{
+    if (ok_) new (&value_) T(other.value_);
+}
+
+template<typename T>
+Result<T>::
+Result(Result&& other) :
+    ok_(other.ok_), failure_(std::move(other.failure_))
+{
+    if (ok_) new (&value_) T(std::move(other.value_));
+}
+
+template<typename T>
+Result<T>&
+Result<T>::
+operator=(Result other)
+{
+    if (ok_) value_.~T();
+
+    ok_ = other.ok_;
+    failure_ = std::move(other.failure_);
+    if (ok_) new (&value_) T(std::move(other.value_));
+
+    return *this;
+}
+
+template<typename T>
+T&
+Result<T>::
+value()
+{
+    if (!ok_) reflectError("%s", failure_.what());
+    return value_;
+}
+
+template<typename T>
+const T&
+Result<T>::
+value() const
+{
+    if (!ok_) reflectError("%s", failure_.what());
+    return value_;
+}
+
+template<typename T>
+T&
+Result<T&>::
+value() const
+{
+    if (!value_) reflectError("%s", failure_.what());
+    return *value_;
+}
+
+inline void
+Result<void>::
+value() const
+{
+    if (!ok_) reflectError("%s", failure_.what());
+}
+
+} // reflect
@@ -12,14 +12,85 @@
 
 namespace reflect {
 
+/******************************************************************************/
+/* TYPE KIND                                                                  */
+/******************************************************************************/
+
+std::ostream& operator<<(std::ostream& stream, TypeKind kind)
+{
+    switch(kind)
+    {
+    case TypeKind::Object:     stream << "Object"; break;
+    case TypeKind::Void:       stream << "Void"; break;
+    case TypeKind::Bool:       stream << "Bool"; break;
+    case TypeKind::Char:       stream << "Char"; break;
+    case TypeKind::SChar:      stream << "SChar"; break;
+    case TypeKind::UChar:      stream << "UChar"; break;
+    case TypeKind::Short:      stream << "Short"; break;
+    case TypeKind::UShort:     stream << "UShort"; break;
+    case TypeKind::Int:        stream << "Int"; break;
+    case TypeKind::UInt:       stream << "UInt"; break;
+    case TypeKind::Long:       stream << "Long"; break;
+    case TypeKind::ULong:      stream << "ULong"; break;
+    case TypeKind::LongLong:   stream << "LongLong"; break;
+    case TypeKind::ULongLong:  stream << "ULongLong"; break;
+    case TypeKind::Float:      stream << "Float"; break;
+    case TypeKind::Double:     stream << "Double"; break;
+    case TypeKind::LongDouble: stream << "LongDouble"; break;
+    default: reflectError("unknown type kind value");
+    };
+
+    return stream;
+}
+
+
+/******************************************************************************/
+/* POINTER KIND                                                               */
+/******************************************************************************/
+
+std::ostream& operator<<(std::ostream& stream, PointerKind kind)
+{
+    switch(kind)
+    {
+    case PointerKind::None:   stream << "None"; break;
+    case PointerKind::Raw:    stream << "Raw"; break;
+    case PointerKind::Shared: stream << "Shared"; break;
+    case PointerKind::Unique: stream << "Unique"; break;
+    case PointerKind::Custom: stream << "Custom"; break;
+    default: reflectError("unknown pointer kind value");
+    };
+
+    return stream;
+}
+
+
 /******************************************************************************/
 /* TYPE                                                                       */
 /******************************************************************************/
 
 Type::
 Type(std::string id) :
-    id_(std::move(id)), parent_(nullptr), pointee_(nullptr)
-{}
+    id_(std::move(id)),
+    parent_(nullptr),
+    kind_(TypeKind::Object),
+    pointee_(nullptr),
+    pointerKind_(PointerKind::None),
+    pointerGetter_(nullptr)
+{
+    std::fill(std::begin(ops_), std::end(ops_), nullptr);
+    for (auto& slot : cache_) slot.store(nullptr, std::memory_order_relaxed);
+}
+
+size_t
+Type::
+cacheSlot()
+{
+    static std::atomic<size_t> next(0);
+
+    size_t slot = next++;
+    if (slot >= CacheSlots) reflectError("out of type cache slots <%lu>", slot);
+    return slot;
+}
 
 bool
 Type::
@@ -97,7 +168,11 @@ addFunction(const std::string& name, Function&& fn)
                 name, it->second.print(), id());
     }
 
-    fns_[name].add(std::move(fn));
+    auto& fns = fns_[name];
+    fns.add(std::move(fn));
+
+    Operator op = operatorId(name);
+    if (op != Operator::Size) ops_[size_t(op)] = &fns;
 }
 
 void
@@ -157,6 +232,48 @@ function(const std::string& fn) const
     return parent_->function(fn);
 }
 
+const Overloads*
+Type::
+operatorFn(Operator op) const
+{
+    for (const Type* type = this; type; type = type->parent_) {
+        if (const Overloads* fns = type->ops_[size_t(op)]) return fns;
+    }
+    return nullptr;
+}
+
+const Overloads&
+Type::
+function(Operator op) const
+{
+    const Overloads* fns = operatorFn(op);
+    if (!fns)
+        reflectError("<%s> doesn't have a function <%s>", id_, operatorName(op));
+
+    return *fns;
+}
+
+Result<const Overloads&>
+Type::
+tryFunction(Operator op) const
+{
+    const Overloads* fns = operatorFn(op);
+    if (!fns) return Failure::function(this, operatorName(op));
+    return *fns;
+}
+
+Result<const Overloads&>
+Type::
+tryFunction(const std::string& fn) const
+{
+    for (const Type* type = this; type; type = type->parent_) {
+        auto it = type->fns_.find(fn);
+        if (it != type->fns_.end()) return it->second;
+    }
+
+    return Failure::function(this, fn);
+}
+
 void
 Type::
 addField(const std::string& name, Field&& field)
@@ -231,11 +348,16 @@ field(const std::string& field) const
     return parent_->field(field);
 }
 
-bool
+Result<const Field&>
 Type::
-isPointer() const
+tryField(const std::string& field) const
 {
-    return is("pointer");
+    for (const Type* type = this; type; type = type->parent_) {
+        auto it = type->fields_.find(field);
+        if (it != type->fields_.end()) return it->second;
+    }
+
+    return Failure::field(this, field);
 }
 
 std::string
@@ -256,13 +378,23 @@ pointee() const
 
 void
 Type::
-setPointer(std::string pointer, const Type* pointee)
+setPointer(
+        std::string pointer,
+        const Type* pointee,
+        PointerKind kind,
+        PointerGetter getter)
 {
     if (isPointer()) reflectError("<%s> is already a pointer", id());
+    if (kind == PointerKind::None)
+        reflectError("<%s> can't be set as a pointer of kind None", id());
+    if (kind != PointerKind::Raw && kind != PointerKind::Custom && !getter)
+        reflectError("<%s> requires a pointer getter", id());
 
     addTrait("pointer");
     pointer_ = std::move(pointer);
     pointee_ = pointee;
+    pointerKind_ = kind;
+    pointerGetter_ = getter;
 }
 
 Value
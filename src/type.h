@@ -10,6 +10,26 @@
 
 namespace reflect {
 
+/******************************************************************************/
+/* POINTER KIND                                                               */
+/******************************************************************************/
+
+enum struct PointerKind
+{
+    None,
+    Raw,
+    Shared,
+    Unique,
+    Custom,
+};
+
+std::ostream& operator<<(std::ostream& stream, PointerKind kind);
+
+// Returns the address of the object pointed to by the given pointer object or
+// nullptr if the pointer is null.
+typedef void* (*PointerGetter)(const void* pointer);
+
+
 /******************************************************************************/
 /* TYPE                                                                       */
 /******************************************************************************/
@@ -27,6 +47,10 @@ struct Type : public Traits
     const Type* parent() const { return parent_; }
     void parent(const Type* parent) { parent_ = parent; }
 
+    TypeKind kind() const { return kind_; }
+    void kind(TypeKind kind) { kind_ = kind; }
+    bool isArithmetic() const { return reflect::isArithmetic(kind_); }
+
     template<typename Fn>
     void addFunction(const std::string& name, Fn&& rawFn);
     void addFunction(const std::string& name, Function&& fn);
@@ -35,6 +59,12 @@ struct Type : public Traits
     bool hasFunction(const std::string& fn) const;
     Overloads& function(const std::string& fn);
     const Overloads& function(const std::string& fn) const;
+    Result<const Overloads&> tryFunction(const std::string& fn) const;
+
+    // Operators are also indexed by their enum which avoids the name lookup.
+    bool hasFunction(Operator op) const { return operatorFn(op); }
+    const Overloads& function(Operator op) const;
+    Result<const Overloads&> tryFunction(Operator op) const;
 
     template<typename T>
     void addField(const std::string& name, size_t offset);
@@ -44,11 +74,28 @@ struct Type : public Traits
     bool hasField(const std::string& field) const;
     Field& field(const std::string& field);
     const Field& field(const std::string& field) const;
+    Result<const Field&> tryField(const std::string& field) const;
 
-    bool isPointer() const;
+    bool isPointer() const { return pointerKind_ != PointerKind::None; }
     std::string pointer() const;
     const Type* pointee() const;
-    void setPointer(std::string pointer, const Type* pointee);
+    void setPointer(
+            std::string pointer,
+            const Type* pointee,
+            PointerKind kind = PointerKind::Custom,
+            PointerGetter getter = nullptr);
+
+    // Raw pointers are loaded inline while everything else goes through the
+    // getter registered with the pointer. Custom pointers may not have one in
+    // which case they can only be dereferenced through their operator*.
+    PointerKind pointerKind() const { return pointerKind_; }
+    bool hasPointerGetter() const { return pointerGetter_; }
+    void* pointerGet(const void* pointer) const
+    {
+        if (pointerKind_ == PointerKind::Raw)
+            return *static_cast<void* const*>(pointer);
+        return pointerGetter_(pointer);
+    }
 
     template<typename T>
     bool isParentOf() const { return isParentOf(type<T>()); }
@@ -76,21 +123,54 @@ struct Type : public Traits
     template<typename Ret, typename... Args>
     Ret call(const std::string& fn, Args&&... args) const;
 
+    template<typename Ret, typename... Args>
+    Result<Ret> tryCall(const std::string& fn, Args&&... args) const;
+
+    template<typename Ret, typename... Args>
+    Ret call(Operator op, Args&&... args) const;
+
     std::string print(size_t indent = 0) const;
 
+    // Slots where utilities can cache data derived from the type, such as
+    // codecs, without going through a global map. Slots are allocated once
+    // via cacheSlot() and values are published with release semantics so
+    // they must be complete before being stored.
+    enum { CacheSlots = 8 };
+    static size_t cacheSlot();
+
+    const void* cache(size_t slot) const
+    {
+        return cache_[slot].load(std::memory_order_acquire);
+    }
+
+    void cache(size_t slot, const void* value) const
+    {
+        cache_[slot].store(value, std::memory_order_release);
+    }
+
 private:
 
     void functions(std::vector<std::string>& result) const;
     void fields(std::vector<std::string>& result) const;
 
+    const Overloads* operatorFn(Operator op) const;
+
     std::string id_;
     const Type* parent_;
+    TypeKind kind_;
 
     std::string pointer_;
     const Type* pointee_;
+    PointerKind pointerKind_;
+    PointerGetter pointerGetter_;
 
     std::unordered_map<std::string, Field> fields_;
     std::unordered_map<std::string, Overloads> fns_;
+
+    // Points into fns_ which never invalidates references to its values.
+    const Overloads* ops_[size_t(Operator::Size)];
+
+    mutable std::atomic<const void*> cache_[CacheSlots];
 };
 
 
@@ -46,4 +46,23 @@ call(const std::string& fn, Args&&... args) const
     return function(fn).call<Ret>(std::forward<Args>(args)...);
 }
 
+template<typename Ret, typename... Args>
+Ret
+Type::
+call(Operator op, Args&&... args) const
+{
+    return function(op).call<Ret>(std::forward<Args>(args)...);
+}
+
+template<typename Ret, typename... Args>
+Result<Ret>
+Type::
+tryCall(const std::string& fn, Args&&... args) const
+{
+    auto overloads = tryFunction(fn);
+    if (!overloads) return overloads.failure();
+
+    return overloads.value().tryCall<Ret>(std::forward<Args>(args)...);
+}
+
 } // namespace reflect
@@ -0,0 +1,80 @@
+/* type_kind.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tags the builtin types so that they can be operated on without going through
+   the function tables.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* TYPE KIND                                                                  */
+/******************************************************************************/
+
+enum struct TypeKind
+{
+    Object,
+    Void,
+
+    // Everything from here on is an arithmetic type.
+    Bool,
+    Char,
+    SChar,
+    UChar,
+    Short,
+    UShort,
+    Int,
+    UInt,
+    Long,
+    ULong,
+    LongLong,
+    ULongLong,
+    Float,
+    Double,
+    LongDouble,
+};
+
+inline bool isArithmetic(TypeKind kind) { return kind >= TypeKind::Bool; }
+
+std::ostream& operator<<(std::ostream& stream, TypeKind kind);
+
+
+/******************************************************************************/
+/* TYPE KIND OF                                                               */
+/******************************************************************************/
+
+template<typename T> struct TypeKindOf
+{
+    static constexpr TypeKind value = TypeKind::Object;
+};
+
+#define reflectTypeKind(type, kind)                                     \
+    template<> struct TypeKindOf<type>                                  \
+    {                                                                   \
+        static constexpr TypeKind value = TypeKind::kind;               \
+    }
+
+reflectTypeKind(void,                   Void);
+reflectTypeKind(bool,                   Bool);
+reflectTypeKind(char,                   Char);
+reflectTypeKind(signed char,            SChar);
+reflectTypeKind(unsigned char,          UChar);
+reflectTypeKind(short int,              Short);
+reflectTypeKind(unsigned short int,     UShort);
+reflectTypeKind(int,                    Int);
+reflectTypeKind(unsigned int,           UInt);
+reflectTypeKind(long int,               Long);
+reflectTypeKind(unsigned long int,      ULong);
+reflectTypeKind(long long int,          LongLong);
+reflectTypeKind(unsigned long long int, ULongLong);
+reflectTypeKind(float,                  Float);
+reflectTypeKind(double,                 Double);
+reflectTypeKind(long double,            LongDouble);
+
+#undef reflectTypeKind
+
+} // reflect
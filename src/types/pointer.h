@@ -17,6 +17,22 @@
 
 namespace reflect {
 
+/******************************************************************************/
+/* POINTER TRAITS                                                             */
+/******************************************************************************/
+
+template<typename T>
+struct PointerTraits<T*>
+{
+    static constexpr PointerKind kind = PointerKind::Raw;
+
+    static void* get(const void* ptr)
+    {
+        return (void*) *static_cast<T* const*>(ptr);
+    }
+};
+
+
 /******************************************************************************/
 /* REFLECT POINTERS                                                           */
 /******************************************************************************/
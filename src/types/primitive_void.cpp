@@ -16,4 +16,5 @@ reflectTypeImpl(void)
 {
     reflectTypeTrait(primitive);
     reflectTypeTrait(void);
+    type_->kind(TypeKind::Void);
 }
@@ -0,0 +1,17 @@
+/* arena.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   reflect::Arena reflection implementation.
+*/
+
+#include "arena.h"
+
+/******************************************************************************/
+/* ARENA                                                                      */
+/******************************************************************************/
+
+// Only ever passed around by reference to the allocation hooks.
+reflectTypeImpl(reflect::Arena)
+{
+}
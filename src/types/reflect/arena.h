@@ -0,0 +1,16 @@
+/* arena.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Type for reflect::Arena.
+*/
+
+#pragma once
+
+#include "reflect.h"
+
+/******************************************************************************/
+/* REFLECT ARENA                                                              */
+/******************************************************************************/
+
+reflectTypeDecl(reflect::Arena)
@@ -39,6 +39,15 @@ void reflectMap(Type* type_)
     reflectCustom(operator[]) (T_& value, const KeyT& k) -> ValueT& {
         return value[k];
     };
+
+    // Returns the value at the key, inserting a default constructed one if
+    // it's missing, so that it can be filled in place.
+    reflectCustom(emplace) (T_& value, const KeyT& k) -> ValueT& {
+        return value.emplace(k, ValueT()).first->second;
+    };
+    reflectCustom(erase) (T_& value, const KeyT& k) -> size_t {
+        return value.erase(k);
+    };
     reflectCustom(at) (const T_& value, const KeyT& k) -> const ValueT& {
         auto it = value.find(k);
         if (it != value.end()) return it->second;
@@ -96,9 +105,10 @@ struct Reflect< std::unordered_map<KeyT, ValueT> >
 
     reflectTemplateLoader()
 
-    static void reflect(Type* type)
+    static void reflect(Type* type_)
     {
-        details::reflectMap<T_, KeyT, ValueT>(type);
+        details::reflectMap<T_, KeyT, ValueT>(type_);
+        reflectFn(reserve);
     }
 };
 
@@ -19,6 +19,33 @@
 
 namespace reflect {
 
+/******************************************************************************/
+/* POINTER TRAITS                                                             */
+/******************************************************************************/
+
+template<typename T>
+struct PointerTraits< std::shared_ptr<T> >
+{
+    static constexpr PointerKind kind = PointerKind::Shared;
+
+    static void* get(const void* ptr)
+    {
+        return (void*) static_cast<const std::shared_ptr<T>*>(ptr)->get();
+    }
+};
+
+template<typename T>
+struct PointerTraits< std::unique_ptr<T> >
+{
+    static constexpr PointerKind kind = PointerKind::Unique;
+
+    static void* get(const void* ptr)
+    {
+        return (void*) static_cast<const std::unique_ptr<T>*>(ptr)->get();
+    }
+};
+
+
 /******************************************************************************/
 /* REFLECT SMART PTR                                                          */
 /******************************************************************************/
@@ -43,6 +70,26 @@ void reflectSmartPtr(Type* type_)
     };
 }
 
+/** Replaces the pointee with a default constructed one that shares a single
+    allocation with the control block, either from the heap or from an arena,
+    and returns it so that it can be filled in place.
+ */
+template<typename T_, typename InnerT>
+void reflectSharedEmplace(Type* type_, std::true_type)
+{
+    reflectCustom(emplace) (T_& value) -> InnerT& {
+        value = std::make_shared<InnerT>();
+        return *value;
+    };
+    reflectCustom(emplace) (T_& value, Arena& arena) -> InnerT& {
+        value = std::allocate_shared<InnerT>(ArenaAllocator<InnerT>(arena));
+        return *value;
+    };
+}
+
+template<typename T_, typename InnerT>
+void reflectSharedEmplace(Type*, std::false_type) {}
+
 } // namespace reflect
 
 
@@ -57,6 +104,9 @@ reflectTemplate(std::shared_ptr, T)
     reflectSmartPtr<T_, T>(type_);
     reflectFnTyped(reset, void (T_::*) ());
     reflectFnTyped(reset, void (T_::*) (T*));
+
+    reflect::reflectSharedEmplace<T_, T>(
+            type_, typename std::is_default_constructible<T>::type());
 }
 
 
@@ -28,9 +28,18 @@ reflectTemplate(std::vector, ValueT)
 
     reflectFn(size);
     reflectFn(clear);
+    reflectFn(reserve);
     reflectFnTyped(resize, void (T_::*) (size_t));
     reflectFnTyped(push_back, void (T_::*) (const ValueT&));
     reflectFnTyped(push_back, void (T_::*) (ValueT&&));
+    reflectFn(pop_back);
+
+    // Appends a default constructed element and returns it so that it can be
+    // filled in place.
+    reflectCustom(emplace_back) (T_& value) -> ValueT& {
+        value.emplace_back();
+        return value.back();
+    };
 
     reflectCustom(operator[]) (T_& value, size_t i) -> ValueT& {
         return value[i];
@@ -23,7 +23,7 @@ get(const Path& path) const
     const Type* target = type<T>();
     Value value = operator[](path).get<T>();
 
-    if (!target->isPointer()) value = *value;
+    if (!target->isPointer()) value = value.pointee();
     return cast<T>(value);
 }
 
@@ -150,7 +150,7 @@ bool has(Value value, const Path& path, size_t index)
     if (index == path.size()) return true;
 
     if (value.type()->isPointer())
-        return has(*value, path, index);
+        return has(value.pointee(), path, index);
 
     if (value.is("list")) {
         if (!path.isIndex(index)) return false;
@@ -180,7 +180,7 @@ Value get(Value value, const Path& path, size_t index)
     if (index == path.size()) return value;
 
     if (value.type()->isPointer())
-        return get(*value, path, index);
+        return get(value.pointee(), path, index);
 
     if (value.is("list")) {
         if (!value.isConst())
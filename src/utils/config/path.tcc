@@ -16,7 +16,7 @@ template<typename Arg>
 void set(Value value, const Path& path, size_t index, Arg&& arg)
 {
     if (value.type()->isPointer())
-        details::set(*value, path, index, std::forward<Arg>(arg));
+        details::set(value.pointee(), path, index, std::forward<Arg>(arg));
 
     else if (value.is("list")) {
         value.call<void>("resize", path.index(index) + 1);
@@ -0,0 +1,458 @@
+/* document.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include "json.h"
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* DOCUMENT CACHE                                                             */
+/******************************************************************************/
+
+// Key indexes of the large objects of a document, keyed by the position of the
+// object on the tape, which are built on demand. An index is never modified
+// once built so only the lookup of the index itself needs to be synchronized.
+struct DocumentCache
+{
+    typedef std::unordered_map<StringRef, Node, StringRef::Hash> Index;
+
+    const Index& index(size_t pos, const Node& object)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        auto& index = indexes[pos];
+        if (index) return *index;
+
+        index.reset(new Index);
+        index->reserve(object.size());
+
+        // emplace keeps the first of any duplicate keys.
+        for (auto it = object.begin(), end = object.end(); it != end; ++it)
+            index->emplace(it.key(), *it);
+
+        return *index;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        indexes.clear();
+    }
+
+private:
+    std::mutex lock;
+    std::unordered_map<size_t, std::unique_ptr<Index> > indexes;
+};
+
+} // namespace details
+
+
+/******************************************************************************/
+/* DOCUMENT                                                                   */
+/******************************************************************************/
+
+Document::
+Document() : cache(new details::DocumentCache)
+{}
+
+Document::
+~Document()
+{}
+
+Document::
+Document(const Document& other) :
+    tape(other.tape), strings(other.strings),
+    cache(new details::DocumentCache)
+{}
+
+Document&
+Document::
+operator=(const Document& other)
+{
+    if (this == &other) return *this;
+
+    tape = other.tape;
+    strings = other.strings;
+    cache->clear();
+
+    return *this;
+}
+
+Document::
+Document(Document&& other) :
+    tape(std::move(other.tape)), strings(std::move(other.strings)),
+    cache(new details::DocumentCache)
+{
+    other.clear();
+}
+
+Document&
+Document::
+operator=(Document&& other)
+{
+    if (this == &other) return *this;
+
+    tape = std::move(other.tape);
+    strings = std::move(other.strings);
+    cache->clear();
+    other.clear();
+
+    return *this;
+}
+
+void
+Document::
+clear()
+{
+    tape.clear();
+    strings.clear();
+    cache->clear();
+}
+
+Node
+Document::
+root() const
+{
+    if (tape.empty()) return Node();
+    return Node(this, 0);
+}
+
+size_t
+Document::
+memory() const
+{
+    return tape.capacity() * sizeof(details::TapeEntry) + strings.capacity();
+}
+
+void
+Document::
+parseJson(Reader& reader)
+{
+    clear();
+    parseNode(reader);
+    if (!reader) clear();
+}
+
+void
+Document::
+printJson(Writer& writer) const
+{
+    if (tape.empty()) printNull(writer);
+    else root().print(writer);
+}
+
+void
+Document::
+pushString(StringRef str)
+{
+    details::TapeEntry entry;
+    entry.kind = Node::String;
+    entry.size = str.size();
+    entry.offset = strings.size();
+    tape.push_back(entry);
+
+    strings.append(str.data(), str.size());
+}
+
+// Containers are pushed before their children and patched once they're
+// complete.
+void
+Document::
+parseNode(Reader& reader)
+{
+    Token token = reader.peekToken();
+    if (!reader) return;
+
+    details::TapeEntry entry;
+    entry.size = 0;
+    entry.int_ = 0;
+
+    switch (token.type()) {
+
+    case Token::Null:
+        parseNull(reader);
+        entry.kind = Node::Null;
+        tape.push_back(entry);
+        break;
+
+    case Token::Bool:
+        entry.kind = Node::Bool;
+        entry.bool_ = parseBool(reader);
+        tape.push_back(entry);
+        break;
+
+    case Token::Int:
+        entry.kind = Node::Int;
+        entry.int_ = parseInt(reader);
+        tape.push_back(entry);
+        break;
+
+    case Token::Float:
+        entry.kind = Node::Float;
+        entry.float_ = parseFloat(reader);
+        tape.push_back(entry);
+        break;
+
+    case Token::String:
+        pushString(reader.nextToken().asStringRef());
+        break;
+
+    case Token::ArrayStart: {
+        size_t pos = tape.size();
+        entry.kind = Node::Array;
+        tape.push_back(entry);
+
+        size_t n = 0;
+        parseArray(reader, [&] (size_t) { parseNode(reader); n++; });
+
+        tape[pos].size = n;
+        tape[pos].end = tape.size();
+        break;
+    }
+
+    case Token::ObjectStart: {
+        size_t pos = tape.size();
+        entry.kind = Node::Object;
+        tape.push_back(entry);
+
+        size_t n = 0;
+        auto onField = [&] (StringRef key) {
+            pushString(key);
+            parseNode(reader);
+            n++;
+        };
+        parseObject(reader, onField);
+
+        tape[pos].size = n;
+        tape[pos].end = tape.size();
+        break;
+    }
+
+    default:
+        reader.error("unexpected token <%s>", token.print());
+        break;
+    }
+}
+
+
+/******************************************************************************/
+/* NODE                                                                       */
+/******************************************************************************/
+
+namespace {
+
+const char* kindName(Node::Kind kind)
+{
+    static const char* names[] =
+        { "null", "bool", "int", "float", "string", "array", "object" };
+    return names[kind];
+}
+
+void checkKind(const Node& node, Node::Kind kind)
+{
+    if (!node.valid()) reflectError("invalid json node");
+    if (node.kind() != kind)
+        reflectError("json node <%s> is not <%s>", kindName(node.kind()), kindName(kind));
+}
+
+} // namespace anonymous
+
+bool
+Node::
+asBool() const
+{
+    checkKind(*this, Bool);
+    return entry().bool_;
+}
+
+int64_t
+Node::
+asInt() const
+{
+    checkKind(*this, Int);
+    return entry().int_;
+}
+
+double
+Node::
+asFloat() const
+{
+    if (is(Int)) return entry().int_;
+
+    checkKind(*this, Float);
+    return entry().float_;
+}
+
+StringRef
+Node::
+asString() const
+{
+    checkKind(*this, String);
+    return StringRef(doc->strings.data() + entry().offset, entry().size);
+}
+
+size_t
+Node::
+size() const
+{
+    if (!is(Array)) checkKind(*this, Object);
+    return entry().size;
+}
+
+size_t
+Node::
+next() const
+{
+    const details::TapeEntry& entry = this->entry();
+    return entry.kind == Array || entry.kind == Object ? entry.end : index + 1;
+}
+
+Node::Iterator&
+Node::Iterator::
+operator++()
+{
+    index = Node(doc, index + object).next();
+    return *this;
+}
+
+Node::Iterator
+Node::
+begin() const
+{
+    if (!is(Array)) checkKind(*this, Object);
+    return Iterator(doc, index + 1, kind() == Object);
+}
+
+Node::Iterator
+Node::
+end() const
+{
+    if (!is(Array)) checkKind(*this, Object);
+    return Iterator(doc, entry().end, kind() == Object);
+}
+
+Node
+Node::
+at(size_t i) const
+{
+    checkKind(*this, Array);
+    if (i >= size()) reflectError("index <%lu> out-of-bound <%lu>", i, size());
+
+    auto it = begin();
+    while (i--) ++it;
+    return *it;
+}
+
+Node
+Node::
+find(StringRef key) const
+{
+    checkKind(*this, Object);
+
+    if (size() > LinearFields) {
+        const auto& index = doc->cache->index(this->index, *this);
+        auto it = index.find(key);
+        return it != index.end() ? it->second : Node();
+    }
+
+    for (auto it = begin(), last = end(); it != last; ++it)
+        if (it.key() == key) return *it;
+
+    return Node();
+}
+
+Node
+Node::
+at(StringRef key) const
+{
+    Node node = find(key);
+    if (!node.valid()) reflectError("missing json key <%s>", key.str());
+    return node;
+}
+
+Value
+Node::
+value() const
+{
+    if (!valid()) return Value();
+
+    switch (kind()) {
+
+    case Null: return Value();
+    case Bool: return Value(asBool());
+    case Int: return Value(asInt());
+    case Float: return Value(asFloat());
+    case String: return Value(asString().str());
+
+    case Array: {
+        details::ValueParser::ArrayT array;
+        array.reserve(size());
+
+        for (Node item : *this) array.emplace_back(item.value());
+        return Value(std::move(array));
+    }
+
+    case Object: {
+        details::ValueParser::ObjectT obj;
+        obj.reserve(size());
+
+        for (auto it = begin(), last = end(); it != last; ++it)
+            obj.emplace(it.key().str(), (*it).value());
+        return Value(std::move(obj));
+    }
+
+    }
+
+    return Value();
+}
+
+void
+Node::
+print(Writer& writer) const
+{
+    switch (kind()) {
+
+    case Null: printNull(writer); break;
+    case Bool: printBool(writer, asBool()); break;
+    case Int: printInt(writer, asInt()); break;
+    case Float: printFloat(writer, asFloat()); break;
+    case String: formatString(writer, asString()); break;
+
+    case Array: {
+        auto it = begin();
+        auto printFn = [&] (size_t) { (*it).print(writer); ++it; };
+        printArray(writer, size(), printFn);
+        break;
+    }
+
+    case Object: {
+        std::vector<std::string> keys;
+        keys.reserve(size());
+        for (auto it = begin(), last = end(); it != last; ++it)
+            keys.push_back(it.key().str());
+
+        auto it = begin();
+        auto printFn = [&] (const std::string&) { (*it).print(writer); ++it; };
+        printObject(writer, keys, printFn);
+        break;
+    }
+
+    }
+}
+
+} // namespace json
+} // namespace reflect
+
+
+reflectTypeImpl(reflect::json::Document)
+{
+    reflectPlumbing();
+
+    reflectFn(parseJson);
+    reflectFn(printJson);
+    reflectTypeValue(json, reflect::json::custom("parseJson", "printJson"));
+}
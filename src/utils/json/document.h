@@ -0,0 +1,198 @@
+/* document.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Compact immutable representation of untyped json.
+
+   A document is a single tape of fixed size entries laid out in the order of
+   the input along with an arena that holds all of its strings. Containers
+   record the number of children they hold and where their subtree ends so
+   that any subtree can be skipped in constant time. Object fields are stored
+   as a key entry immediately followed by the value.
+
+   Nodes are cheap views into a document which remain valid for as long as the
+   document isn't modified or destroyed. Objects with few fields are searched
+   linearly while larger ones get a hashed index of their keys on first
+   lookup. Duplicate keys resolve to the first occurrence.
+
+   Documents are an opt-in alternative for code that only needs to read
+   untyped json. Parsing into a Value still goes through the ValueParser of
+   parser.cpp which builds its vectors and maps directly.
+*/
+
+#include "json.h"
+#pragma once
+
+#include <memory>
+
+namespace reflect {
+namespace json {
+
+struct Node;
+namespace details { struct DocumentCache; }
+
+
+/******************************************************************************/
+/* TAPE ENTRY                                                                 */
+/******************************************************************************/
+
+namespace details {
+
+struct TapeEntry
+{
+    uint32_t kind;
+
+    // Length of strings or number of children of containers.
+    uint32_t size;
+
+    union
+    {
+        bool bool_;
+        int64_t int_;
+        double float_;
+        uint64_t offset; // strings: position within the arena.
+        uint64_t end;    // containers: index of the entry following the subtree.
+    };
+};
+
+} // namespace details
+
+
+/******************************************************************************/
+/* DOCUMENT                                                                   */
+/******************************************************************************/
+
+struct Document
+{
+    Document();
+    ~Document();
+
+    Document(const Document& other);
+    Document& operator=(const Document& other);
+    Document(Document&& other);
+    Document& operator=(Document&& other);
+
+    bool empty() const { return tape.empty(); }
+    void clear();
+
+    Node root() const;
+
+    // Bytes used by the tape and the string arena.
+    size_t memory() const;
+
+    void parseJson(Reader& reader);
+    void printJson(Writer& writer) const;
+
+private:
+    friend struct Node;
+
+    void parseNode(Reader& reader);
+    void pushString(StringRef str);
+
+    std::vector<details::TapeEntry> tape;
+    std::string strings;
+
+    std::unique_ptr<details::DocumentCache> cache;
+};
+
+
+/******************************************************************************/
+/* NODE                                                                       */
+/******************************************************************************/
+
+struct Node
+{
+    enum Kind { Null, Bool, Int, Float, String, Array, Object };
+
+    // Objects with more fields than this are indexed on first lookup.
+    enum { LinearFields = 16 };
+
+    // Default constructed nodes are used to signal a missing key.
+    Node() : doc(nullptr), index(0) {}
+    Node(const Document* doc, size_t index) : doc(doc), index(index) {}
+
+    bool valid() const { return doc; }
+
+    Kind kind() const { return Kind(entry().kind); }
+    bool is(Kind kind) const { return valid() && this->kind() == kind; }
+    bool isNull() const { return is(Null); }
+
+    bool asBool() const;
+    int64_t asInt() const;
+    double asFloat() const; // Also accepts integers.
+    StringRef asString() const;
+
+    // Number of elements or fields of a container.
+    size_t size() const;
+
+    // Elements are reached by skipping over their predecessors.
+    Node at(size_t i) const;
+
+    // Returns an invalid node if the key doesn't exist.
+    Node find(StringRef key) const;
+    Node at(StringRef key) const;
+
+    // Walks the children of a container. The key is only available for
+    // objects.
+    struct Iterator
+    {
+        Iterator(const Document* doc, size_t index, bool object) :
+            doc(doc), index(index), object(object)
+        {}
+
+        Node operator*() const { return Node(doc, index + object); }
+        StringRef key() const { return Node(doc, index).asString(); }
+
+        Iterator& operator++();
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+
+    private:
+        const Document* doc;
+        size_t index;
+        bool object;
+    };
+
+    Iterator begin() const;
+    Iterator end() const;
+
+    // Converts the subtree into the untyped representation used by the Value
+    // parser: vectors and unordered maps of Values. This isn't a view: every
+    // container of the subtree is rebuilt and every string is copied so it
+    // costs as much as parsing the subtree with the ValueParser.
+    Value value() const;
+
+    void print(Writer& writer) const;
+
+private:
+    friend struct Document;
+
+    const details::TapeEntry& entry() const { return doc->tape[index]; }
+    size_t next() const;
+
+    const Document* doc;
+    size_t index;
+};
+
+
+namespace details {
+
+/******************************************************************************/
+/* STATIC CODEC                                                               */
+/******************************************************************************/
+
+template<>
+struct StaticCodec<Document>
+{
+    static void parse(Reader& reader, Document& doc) { doc.parseJson(reader); }
+    static void print(Writer& writer, const Document& doc) { doc.printJson(writer); }
+    static bool isEmpty(const Document& doc) { return doc.empty(); }
+};
+
+} // namespace details
+
+} // namespace json
+} // namespace reflect
+
+reflectTypeDecl(reflect::json::Document)
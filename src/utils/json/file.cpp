@@ -0,0 +1,129 @@
+/* file.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* MAPPED FILE                                                                */
+/******************************************************************************/
+
+namespace {
+
+Error fileError(const char* op, const std::string& path)
+{
+    return Error(errorFormat("unable to %s <%s>: %s", op, path, std::strerror(errno)));
+}
+
+} // namespace anonymous
+
+MappedFile::
+MappedFile(const std::string& path) : data(nullptr), size(0)
+{
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error_ = fileError("open", path);
+        return;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) < 0) {
+        error_ = fileError("stat", path);
+        ::close(fd);
+        return;
+    }
+
+    // Empty files can't be mapped and are left to the reader to report.
+    size = st.st_size;
+    if (!size) {
+        ::close(fd);
+        return;
+    }
+
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        error_ = fileError("map", path);
+        size = 0;
+        ::close(fd);
+        return;
+    }
+
+    ::close(fd);
+    data = static_cast<const char*>(addr);
+
+    // Hints only so failures don't matter.
+    (void) ::madvise(addr, size, MADV_SEQUENTIAL);
+    (void) ::madvise(addr, size, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+    (void) ::madvise(addr, size, MADV_HUGEPAGE);
+#endif
+}
+
+MappedFile::
+~MappedFile()
+{
+    if (data) ::munmap(const_cast<char*>(data), size);
+}
+
+
+/******************************************************************************/
+/* OUTPUT FILE                                                                */
+/******************************************************************************/
+
+OutputFile::
+OutputFile(const std::string& path) : path(path)
+{
+    fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) error_ = fileError("open", path);
+}
+
+OutputFile::
+~OutputFile()
+{
+    if (fd >= 0) ::close(fd);
+}
+
+Writer::Sink
+OutputFile::
+sink()
+{
+    return [this] (const char* data, size_t size) {
+        while (size) {
+            ssize_t n = ::write(fd, data, size);
+
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (!error_) error_ = fileError("write", path);
+                return false;
+            }
+
+            data += n;
+            size -= n;
+        }
+
+        return true;
+    };
+}
+
+void
+OutputFile::
+close()
+{
+    if (fd < 0) return;
+
+    if (::close(fd) < 0 && !error_) error_ = fileError("close", path);
+    fd = -1;
+}
+
+} // namespace details
+} // namespace json
+} // namespace reflect
@@ -0,0 +1,137 @@
+/* file.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parsing and printing of json files.
+
+   Files are parsed straight out of a read-only memory mapping of their
+   content so they go through the contiguous reader which reports errors with
+   the line and column of the file. The mapping is gone once parseFile returns
+   so strings are never borrowed from it: StringRef fields are copied into the
+   arena given to parseFile and fail to parse without one.
+   Printing goes through a writer which gathers its output in large blocks
+   before writing them to the file.
+*/
+
+#include "json.h"
+#pragma once
+
+namespace reflect {
+namespace json {
+
+
+/******************************************************************************/
+/* FILES                                                                      */
+/******************************************************************************/
+
+namespace details {
+
+// Read-only mapping of an entire file which is advised for a sequential read.
+struct MappedFile
+{
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* begin() const { return data; }
+    const char* end() const { return data + size; }
+
+    const Error& error() const { return error_; }
+
+private:
+    const char* data;
+    size_t size;
+    Error error_;
+};
+
+// File which is truncated on open and written to by the sink.
+struct OutputFile
+{
+    explicit OutputFile(const std::string& path);
+    ~OutputFile();
+
+    OutputFile(const OutputFile&) = delete;
+    OutputFile& operator=(const OutputFile&) = delete;
+
+    Writer::Sink sink();
+
+    // Closing can fail on filesystems which defer their writes.
+    void close();
+
+    const Error& error() const { return error_; }
+
+private:
+    std::string path;
+    int fd;
+    Error error_;
+};
+
+} // namespace details
+
+
+/******************************************************************************/
+/* PARSE FILE                                                                 */
+/******************************************************************************/
+
+namespace details {
+
+template<typename T>
+Error parseMapped(
+        const std::string& path, T& value, Arena* arena, Reader::Options options)
+{
+    details::MappedFile file(path);
+    if (file.error()) return file.error();
+
+    Reader reader(file.begin(), file.end(), options);
+    reader.borrowable(false);
+    reader.arena(arena);
+    parse(reader, value);
+    return reader.error();
+}
+
+} // namespace details
+
+template<typename T>
+Error parseFile(const std::string& path, T& value, Reader::Options options = Reader::Default)
+{
+    return details::parseMapped(path, value, nullptr, options);
+}
+
+// Allocates the pointees of shared pointers and the strings of StringRef
+// fields from the arena.
+template<typename T>
+Error parseFile(
+        const std::string& path, T& value,
+        Arena& arena, Reader::Options options = Reader::Default)
+{
+    return details::parseMapped(path, value, &arena, options);
+}
+
+
+/******************************************************************************/
+/* PRINT FILE                                                                 */
+/******************************************************************************/
+
+template<typename T>
+Error printFile(const std::string& path, const T& value, Writer::Options options = Writer::Default)
+{
+    details::OutputFile file(path);
+    if (file.error()) return file.error();
+
+    {
+        Writer writer(file.sink(), options);
+        print(writer, value);
+        writer.flush();
+
+        if (file.error()) return file.error();
+        if (writer.error()) return writer.error();
+    }
+
+    file.close();
+    return file.error();
+}
+
+} // namespace json
+} // namespace reflect
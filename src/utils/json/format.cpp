@@ -53,7 +53,7 @@ void formatFloat(Writer& writer, double value)
     format(writer, "%1.12g", value);
 }
 
-size_t escapeUnicode(Writer& writer, const std::string& value, size_t i)
+size_t escapeUnicode(Writer& writer, StringRef value, size_t i)
 {
     size_t bytes = clz(~value[i]);
     if (bytes > 4 || bytes < 2) writer.error("invalid UTF-8 header");
@@ -73,48 +73,26 @@ size_t escapeUnicode(Writer& writer, const std::string& value, size_t i)
     return i - 1;
 }
 
-size_t readUnicode(Writer& writer, const std::string& value, size_t i)
+// Unicode is validated in bulk up front so that valid sequences can be copied
+// through like any other character.
+void formatString(Writer& writer, StringRef value)
 {
-    size_t bytes = clz(~value[i]);
-    if (bytes > 4 || bytes < 2) writer.error("invalid UTF-8 header");
-    if (i + bytes > value.size()) writer.error("invalid UTF-8 encoding");
-
-    size_t leftover = 8 - (bytes + 1);
-    uint32_t code = value[i] & ((1 << leftover) - 1);
-    writer.push(value[i]);
-
-    i++;
-    for (size_t j = 0; writer && j < (bytes - 1); ++j, ++i) {
-        if ((value[i] & 0xC0) != 0x80) writer.error("invalid UTF-8 encoding");
-        code = (code << 6) | (value[i] & 0x3F);
-        writer.push(value[i]);
-    }
-
-    switch (bytes) {
-    case 4: if (code <= 0xFFFF) writer.error("invalid UTF-8 encoding"); break;
-    case 3: if (code <= 0x7FF) writer.error("invalid UTF-8 encoding"); break;
-    case 2: if (code <= 0x7F) writer.error("invalid UTF-8 encoding"); break;
+    if (writer.validateUnicode() && !writer.escapeUnicode()) {
+        const char* end = value.data() + value.size();
+        if (details::validateUtf8(value.data(), end) != end) {
+            writer.error("invalid UTF-8 encoding");
+            return;
+        }
     }
 
-    return i - 1;
-}
-
-void formatString(Writer& writer, const std::string& value)
-{
     writer.push('"');
 
     for (size_t i = 0; i < value.size(); ++i) {
         char c = value[i];
 
-        if (c & 0x80) {
-            if (writer.escapeUnicode()) {
-                i = escapeUnicode(writer, value, i);
-                continue;
-            }
-            else if (writer.validateUnicode()) {
-                i = readUnicode(writer, value, i);
-                continue;
-            }
+        if ((c & 0x80) && writer.escapeUnicode()) {
+            i = escapeUnicode(writer, value, i);
+            continue;
         }
 
         switch (c) {
@@ -17,7 +17,7 @@ void formatNull(Writer& writer);
 void formatBool(Writer& writer, bool value);
 void formatInt(Writer& writer, int64_t value);
 void formatFloat(Writer& writer, double value);
-void formatString(Writer& writer, const std::string& value);
+void formatString(Writer& writer, StringRef value);
 
 } // namespace json
 } // namespace reflect
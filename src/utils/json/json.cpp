@@ -15,12 +15,31 @@
 #include "utils.h"
 
 #include <mutex>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <iomanip>
+#include <atomic>
 #include <algorithm>
+#include <thread>
+#include <limits>
+#include <exception>
 
 #include "reader.cpp"
 #include "writer.cpp"
+#include "scan.cpp"
 #include "token.cpp"
 #include "traits.cpp"
 #include "parser.cpp"
 #include "format.cpp"
 #include "printer.cpp"
+#include "static.cpp"
+#include "push.cpp"
+#include "parallel.cpp"
+#include "lines.cpp"
+#include "document.cpp"
+#include "projection.cpp"
+#include "validate.cpp"
+#include "file.cpp"
+#include "string_ref.cpp"
+#include "raw.cpp"
@@ -8,6 +8,10 @@
 #include <istream>
 #include <ostream>
 #include <sstream>
+#include <cmath>
+#include <limits>
+#include <functional>
+#include <cstring>
 
 #include "reflect.h"
 
@@ -20,15 +24,28 @@ struct Reader;
 } // namespace reflect
 
 #include "error.h"
+#include "string_ref.h"
 #include "token.h"
 #include "reader.h"
+#include "scan.h"
+#include "parallel.h"
 #include "writer.h"
 #include "traits.h"
 #include "parser.h"
 #include "format.h"
 #include "printer.h"
+#include "static.h"
+#include "push.h"
+#include "lines.h"
+#include "document.h"
+#include "raw.h"
+#include "projection.h"
+#include "validate.h"
+#include "file.h"
 
 #include "reader.tcc"
 #include "writer.tcc"
 #include "parser.tcc"
 #include "printer.tcc"
+#include "lines.tcc"
+#include "raw.tcc"
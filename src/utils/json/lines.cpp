@@ -0,0 +1,49 @@
+/* lines.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* LINES                                                                      */
+/******************************************************************************/
+
+// Chunks smaller than this aren't worth the cost of spinning up a thread.
+enum { MinLinesChunk = 64 * 1024 };
+
+size_t linesThreads(size_t threads)
+{
+    if (threads) return threads;
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+std::vector<LineRange> splitLines(const char* first, const char* last, size_t n)
+{
+    size_t size = last - first;
+    n = std::max<size_t>(std::min<size_t>(n, size / MinLinesChunk), 1);
+
+    std::vector<LineRange> ranges;
+    ranges.reserve(n);
+
+    const char* it = first;
+    for (size_t i = 1; i < n && it != last; ++i) {
+        const char* split = std::max(it, first + (size / n) * i);
+
+        const char* eol = static_cast<const char*>(
+                std::memchr(split, '\n', last - split));
+        if (!eol) break;
+
+        ranges.push_back({ it, eol + 1 });
+        it = eol + 1;
+    }
+
+    if (it != last || ranges.empty()) ranges.push_back({ it, last });
+    return ranges;
+}
+
+} // namespace details
+} // namespace json
+} // namespace reflect
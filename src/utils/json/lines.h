@@ -0,0 +1,87 @@
+/* lines.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parallel parsing of json lines (one json value per line).
+
+   The input is split into chunks at line boundaries and each chunk is parsed
+   by its own thread with its own reader. The values are appended to the output
+   vector in the order of the input and a line that fails to parse is reported
+   along with its line number without interrupting the rest of the batch.
+   Blank lines are skipped.
+*/
+
+#include "json.h"
+#pragma once
+
+#include <vector>
+
+namespace reflect {
+namespace json {
+
+
+/******************************************************************************/
+/* LINE ERROR                                                                 */
+/******************************************************************************/
+
+// The position within the error message is relative to the start of the line.
+struct LineError
+{
+    size_t line;
+    Error error;
+};
+
+
+/******************************************************************************/
+/* PARSE LINES                                                                */
+/******************************************************************************/
+
+// A thread count of 0 uses one thread per hardware thread.
+template<typename T>
+std::vector<LineError> parseLines(
+        const char* first, const char* last, std::vector<T>& out, size_t threads = 0);
+
+template<typename T>
+std::vector<LineError> parseLines(
+        const std::string& str, std::vector<T>& out, size_t threads = 0);
+
+template<typename T>
+std::vector<LineError> parseLines(std::string&&, std::vector<T>&, size_t = 0) = delete;
+
+// The stream is read and parsed in blocks which start at LinesMinBlockSize
+// bytes and double up to LinesBlockSize bytes as long as the stream fills them.
+// Blocks don't outlive the call so strings are never borrowed from them:
+// StringRef fields are copied into the arena and fail to parse without one.
+template<typename T>
+std::vector<LineError> parseLines(
+        std::istream& stream, std::vector<T>& out, size_t threads = 0);
+
+template<typename T>
+std::vector<LineError> parseLines(
+        std::istream& stream, std::vector<T>& out, Arena& arena, size_t threads = 0);
+
+enum { LinesMinBlockSize = 64 * 1024, LinesBlockSize = 64 * 1024 * 1024 };
+
+
+/******************************************************************************/
+/* DETAILS                                                                    */
+/******************************************************************************/
+
+namespace details {
+
+struct LineRange
+{
+    const char* first;
+    const char* last;
+};
+
+size_t linesThreads(size_t threads);
+
+// Splits the input into at most n ranges of roughly equal size which end right
+// after a newline or at the end of the input.
+std::vector<LineRange> splitLines(const char* first, const char* last, size_t n);
+
+} // namespace details
+
+} // namespace json
+} // namespace reflect
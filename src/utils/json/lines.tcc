@@ -0,0 +1,186 @@
+/* lines.tcc                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include "json.h"
+#pragma once
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* LINES CHUNK                                                                */
+/******************************************************************************/
+
+template<typename T>
+struct LinesChunk
+{
+    size_t lines;
+    std::vector<T> values;
+    std::vector<LineError> errors;
+
+    // Arenas aren't thread-safe so each chunk gets its own which is handed
+    // over to the caller's arena once the chunk is parsed.
+    Arena arena;
+
+    LinesChunk() : lines(0) {}
+
+    // Line numbers of the errors are relative to the start of the chunk.
+    void parse(LineRange range, bool borrowable, bool useArena)
+    {
+        Reader reader(range.first, range.first);
+        if (useArena) reader.arena(&arena);
+
+        for (const char* it = range.first; it != range.last; lines++) {
+            const char* eol = static_cast<const char*>(
+                    std::memchr(it, '\n', range.last - it));
+            if (!eol) eol = range.last;
+
+            const char* start = skipSpace(it, eol);
+            it = eol == range.last ? eol : eol + 1;
+            if (start == eol) continue;
+
+            reader.reset(start, eol);
+            reader.borrowable(borrowable);
+
+            T value{};
+            json::parse(reader, value);
+
+            if (!reader.error()) {
+                const char* rest = skipSpace(reader.cursor(), eol);
+                if (rest != eol) {
+                    reader.advance(rest);
+                    reader.error("unexpected characters after the value");
+                }
+            }
+
+            if (reader.error()) errors.push_back({ lines + 1, reader.error() });
+            else values.push_back(std::move(value));
+        }
+    }
+};
+
+
+/******************************************************************************/
+/* PARSE LINES                                                                */
+/******************************************************************************/
+
+template<typename T>
+size_t parseLines(
+        const char* first, const char* last,
+        std::vector<T>& out, std::vector<LineError>& errors,
+        size_t lineBase, size_t threads, bool borrowable, Arena* arena)
+{
+    auto ranges = splitLines(first, last, linesThreads(threads));
+    std::vector< LinesChunk<T> > chunks(ranges.size());
+
+    runThreads(ranges.size(), [&] (size_t i) {
+                chunks[i].parse(ranges[i], borrowable, arena != nullptr);
+            });
+
+    size_t values = 0;
+    for (const auto& chunk : chunks) values += chunk.values.size();
+    out.reserve(out.size() + values);
+
+    for (auto& chunk : chunks) {
+        for (auto& value : chunk.values) out.push_back(std::move(value));
+
+        for (auto& error : chunk.errors) {
+            error.line += lineBase;
+            errors.push_back(std::move(error));
+        }
+
+        lineBase += chunk.lines;
+        if (arena) arena->absorb(chunk.arena);
+    }
+
+    return lineBase;
+}
+
+// Each block is cut after its last newline and the partial line that follows
+// is carried over to the next block. The block is overwritten by the next read
+// so strings are never borrowed from it.
+template<typename T>
+std::vector<LineError> parseStream(
+        std::istream& stream, std::vector<T>& out, Arena* arena, size_t threads)
+{
+    std::vector<LineError> errors;
+    std::vector<char> block(LinesMinBlockSize);
+
+    size_t lines = 0;
+    size_t carry = 0;
+
+    while (true) {
+        if (carry == block.size()) block.resize(block.size() * 2);
+
+        stream.read(block.data() + carry, block.size() - carry);
+        size_t size = carry + stream.gcount();
+        const char* first = block.data();
+
+        if (!stream) {
+            parseLines(first, first + size, out, errors, lines, threads, false, arena);
+            break;
+        }
+
+        const char* last = first + size;
+        while (last != first && last[-1] != '\n') --last;
+
+        // No newline in the whole block so grow it and keep reading.
+        if (last == first) {
+            carry = size;
+            continue;
+        }
+
+        lines = parseLines(first, last, out, errors, lines, threads, false, arena);
+
+        carry = (first + size) - last;
+        std::memmove(block.data(), last, carry);
+
+        // Small streams never pay for a large block.
+        if (block.size() < LinesBlockSize) block.resize(block.size() * 2);
+    }
+
+    return errors;
+}
+
+} // namespace details
+
+
+/******************************************************************************/
+/* PARSE LINES                                                                */
+/******************************************************************************/
+
+template<typename T>
+std::vector<LineError> parseLines(
+        const char* first, const char* last, std::vector<T>& out, size_t threads)
+{
+    std::vector<LineError> errors;
+    details::parseLines(first, last, out, errors, 0, threads, true, nullptr);
+    return errors;
+}
+
+template<typename T>
+std::vector<LineError> parseLines(
+        const std::string& str, std::vector<T>& out, size_t threads)
+{
+    return parseLines(str.data(), str.data() + str.size(), out, threads);
+}
+
+template<typename T>
+std::vector<LineError> parseLines(
+        std::istream& stream, std::vector<T>& out, size_t threads)
+{
+    return details::parseStream(stream, out, nullptr, threads);
+}
+
+template<typename T>
+std::vector<LineError> parseLines(
+        std::istream& stream, std::vector<T>& out, Arena& arena, size_t threads)
+{
+    return details::parseStream(stream, out, &arena, threads);
+}
+
+} // namespace json
+} // namespace reflect
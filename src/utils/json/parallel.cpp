@@ -0,0 +1,194 @@
+/* parallel.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+namespace reflect {
+namespace json {
+
+/******************************************************************************/
+/* PARALLEL THREADS                                                           */
+/******************************************************************************/
+
+namespace { std::atomic<size_t> parallelThreadsCount(1); }
+
+size_t parallelThreads()
+{
+    return parallelThreadsCount.load(std::memory_order_relaxed);
+}
+
+void parallelThreads(size_t threads)
+{
+    parallelThreadsCount.store(threads, std::memory_order_relaxed);
+}
+
+
+namespace details {
+
+/******************************************************************************/
+/* RUN THREADS                                                                */
+/******************************************************************************/
+
+// Exceptions are carried over to the calling thread.
+void runThreads(size_t n, const std::function<void(size_t)>& fn)
+{
+    if (n == 1) { fn(0); return; }
+
+    std::vector<std::exception_ptr> errors(n);
+    auto run = [&] (size_t i) {
+        try { fn(i); }
+        catch (...) { errors[i] = std::current_exception(); }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(n - 1);
+
+    for (size_t i = 1; i < n; ++i)
+        threads.emplace_back(run, i);
+
+    run(0);
+
+    for (auto& thread : threads) thread.join();
+
+    for (auto& error : errors)
+        if (error) std::rethrow_exception(error);
+}
+
+
+/******************************************************************************/
+/* PARSE PARALLEL                                                             */
+/******************************************************************************/
+
+namespace {
+
+size_t resolveThreads()
+{
+    static const size_t hardware = std::thread::hardware_concurrency();
+
+    size_t threads = parallelThreads();
+    return threads ? threads : hardware;
+}
+
+// Fills bounds with the offsets of the opening bracket, the separators and the
+// closing bracket of the array starting at first. Returns false if the array
+// isn't properly closed.
+bool splitArray(
+        const char* first,
+        const std::vector<uint32_t>& index,
+        std::vector<uint32_t>& bounds)
+{
+    size_t depth = 0;
+
+    for (uint32_t pos : index) {
+        switch (first[pos]) {
+
+        case '[':
+        case '{':
+            if (!depth++) bounds.push_back(pos);
+            break;
+
+        case ']':
+        case '}':
+            if (--depth) break;
+            bounds.push_back(pos);
+            return first[pos] == ']';
+
+        case ',':
+            if (depth == 1) bounds.push_back(pos);
+            break;
+        }
+    }
+
+    return false;
+}
+
+} // namespace anonymous
+
+bool parseParallel(
+        Reader& reader,
+        const std::function<void(size_t)>& resize,
+        const std::function<void(Reader&, size_t)>& item)
+{
+    if (!parallelCandidate(reader)) return false;
+
+    const char* first = skipSpace(reader.cursor(), reader.end());
+    const char* last = reader.end();
+    if (first == last || *first != '[') return false;
+
+    size_t size = last - first;
+    if (size < ParallelMinSize || size > std::numeric_limits<uint32_t>::max())
+        return false;
+
+    size_t threads = resolveThreads();
+    if (threads <= 1) return false;
+
+    std::vector<uint32_t> bounds;
+    {
+        std::vector<uint32_t> index;
+        index.reserve(size / 8);
+        indexStructurals(first, last, index);
+
+        if (!splitArray(first, index, bounds)) return false;
+    }
+
+    size_t n = bounds.size() - 1;
+    if (n < threads) return false;
+
+    resize(n);
+
+    auto options = Reader::Options(
+            (reader.unescapeUnicode() ? Reader::UnescapeUnicode : 0) |
+            (reader.validateUnicode() ? Reader::ValidateUnicode : 0) |
+            (reader.reuse() ? Reader::Reuse : 0));
+
+    std::vector<Error> errors(threads);
+
+    runThreads(threads, [&] (size_t thread) {
+                size_t begin = n * thread / threads;
+                size_t end = n * (thread + 1) / threads;
+
+                // Each element is read from the start of the input so that the
+                // position of errors is relative to the whole document.
+                Reader sub(reader.begin(), reader.begin(), options);
+
+                for (size_t i = begin; i < end; ++i) {
+                    const char* it = first + bounds[i] + 1;
+                    const char* stop = first + bounds[i + 1];
+
+                    sub.reset(reader.begin(), stop);
+                    sub.borrowable(reader.borrowable());
+                    sub.advance(skipSpace(it, stop));
+
+                    if (sub.cursor() == stop) sub.error("missing array element");
+                    else item(sub, i);
+
+                    if (!sub.error()) {
+                        const char* rest = skipSpace(sub.cursor(), stop);
+                        if (rest != stop) {
+                            sub.advance(rest);
+                            sub.error("unexpected character <%c>", *rest);
+                        }
+                    }
+
+                    if (sub.error()) {
+                        errors[thread] = sub.error();
+                        return;
+                    }
+                }
+            });
+
+    // The threads cover the elements in order so the first error is also the
+    // one that the sequential parser would have reported.
+    for (auto& error : errors) {
+        if (!error) continue;
+        reader.error(std::move(error));
+        return true;
+    }
+
+    reader.advance(first + bounds.back() + 1);
+    return true;
+}
+
+} // namespace details
+} // namespace json
+} // namespace reflect
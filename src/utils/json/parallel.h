@@ -0,0 +1,82 @@
+/* parallel.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parallel parsing of large top-level arrays.
+
+   When a vector is parsed from a contiguous buffer and it's the top-level
+   value of a large enough document, the structural characters of the
+   document are first indexed in a single vectorized pass. The index gives
+   away the boundaries of every element of the array so the vector can be
+   sized up front and its elements parsed in place by several threads.
+   Parallel parsing is disabled until parallelThreads() is raised above 1.
+
+   Anything that the index can't make sense of (a truncated document for
+   example) falls back to the sequential parser which is in charge of
+   reporting the error.
+*/
+
+#include "json.h"
+#pragma once
+
+#include <functional>
+
+namespace reflect {
+namespace json {
+
+
+/******************************************************************************/
+/* PARALLEL THREADS                                                           */
+/******************************************************************************/
+
+// Number of threads used to parse large top-level arrays. 1, the default,
+// disables parallel parsing and 0 uses one thread per hardware thread so
+// spawning threads is always opted into.
+size_t parallelThreads();
+void parallelThreads(size_t threads);
+
+// Documents smaller than this are always parsed sequentially.
+enum { ParallelMinSize = 1024 * 1024 };
+
+
+namespace details {
+
+/******************************************************************************/
+/* PARSE PARALLEL                                                             */
+/******************************************************************************/
+
+// Checks that are cheap enough to be done for every array before building the
+// callbacks of parseParallel: the default of a single thread, nested arrays
+// and small documents are turned down without any allocation.
+inline bool parallelCandidate(const Reader& reader)
+{
+    // Comments can hide structural characters from the index and arenas
+    // can't be shared between threads.
+    if (!reader.contiguous() || reader.allowComments() || reader.arena())
+        return false;
+
+    if (size_t(reader.end() - reader.begin()) < ParallelMinSize) return false;
+    if (parallelThreads() == 1) return false;
+
+    // Only the top-level array is worth indexing: a nested one would index the
+    // rest of the document every time. The cursor can't be past the first
+    // bracket either since that would mean that it was already tokenized.
+    return skipSpace(reader.begin(), reader.cursor()) == reader.cursor();
+}
+
+// Calls fn(i) for every i in [0, n) on up to n threads and waits for them.
+void runThreads(size_t n, const std::function<void(size_t)>& fn);
+
+// Parses the array at the cursor of the reader in parallel if it's worth it.
+// resize(n) is called to make room for n elements which are then parsed by
+// calling item(reader, i) on any of the threads. Returns false without
+// consuming anything if the array should be parsed sequentially instead.
+bool parseParallel(
+        Reader& reader,
+        const std::function<void(size_t)>& resize,
+        const std::function<void(Reader&, size_t)>& item);
+
+} // namespace details
+
+} // namespace json
+} // namespace reflect
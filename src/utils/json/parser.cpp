@@ -5,7 +5,7 @@
 
 namespace reflect {
 namespace json {
-namespace {
+namespace details {
 
 /******************************************************************************/
 /* CUSTOM PARSER                                                              */
@@ -23,7 +23,12 @@ std::string customParser(const Type* type)
 
 struct Parser
 {
+    // Allows the push parser to drive the parsers a token at a time. Opaque
+    // parsers must be handed a complete value.
+    enum Kind { Bool, Int, Float, String, Pointer, Array, Map, Object, Opaque };
+
     virtual ~Parser() {};
+    virtual Kind kind() const { return Opaque; }
     virtual void init(const Type*) {}
     virtual void parse(Reader& reader, Value& value) const = 0;
 };
@@ -53,38 +58,207 @@ struct TypeParser
 /* BASIC PARSERS                                                              */
 /******************************************************************************/
 
+// Builtin types are written straight through a pointer of the exact type of
+// the destination which skips resolving operator= for every value.
+template<typename T>
+T* target(Reader& reader, Value& value)
+{
+    if (!value.isConst()) return static_cast<T*>(value.value());
+
+    reader.error("unable to parse into const <%s>", value.type()->id());
+    return nullptr;
+}
+
+template<typename T = void>
 struct BoolParser : public Parser
 {
+    Kind kind() const { return Bool; }
+
+    void parse(Reader& reader, Value& value) const
+    {
+        if (T* ptr = target<T>(reader, value)) *ptr = parseBool(reader);
+    }
+};
+
+// Types flagged with the matching trait which aren't builtins.
+template<>
+struct BoolParser<void> : public Parser
+{
+    Kind kind() const { return Bool; }
+
     void parse(Reader& reader, Value& value) const
     {
         value.assign(parseBool(reader));
     }
 };
 
+template<typename T = void>
 struct IntParser : public Parser
 {
+    Kind kind() const { return Int; }
+
+    void parse(Reader& reader, Value& value) const
+    {
+        if (T* ptr = target<T>(reader, value)) json::parseInt(reader, *ptr);
+    }
+};
+
+template<>
+struct IntParser<void> : public Parser
+{
+    Kind kind() const { return Int; }
+
     void parse(Reader& reader, Value& value) const
     {
-        value.assign(parseInt(reader));
+        value.assign(json::parseInt(reader));
     }
 };
 
+template<typename T = void>
 struct FloatParser : public Parser
 {
+    Kind kind() const { return Float; }
+
     void parse(Reader& reader, Value& value) const
     {
-        value.assign(parseFloat(reader));
+        if (T* ptr = target<T>(reader, value)) json::parseFloat(reader, *ptr);
     }
 };
 
+template<>
+struct FloatParser<void> : public Parser
+{
+    Kind kind() const { return Float; }
+
+    void parse(Reader& reader, Value& value) const
+    {
+        value.assign(json::parseFloat(reader));
+    }
+};
+
+template<typename T = void>
 struct StringParser : public Parser
 {
+    Kind kind() const { return String; }
+
+    void parse(Reader& reader, Value& value) const
+    {
+        T* ptr = target<T>(reader, value);
+        if (!ptr) return;
+
+        Token token = reader.expectToken(Token::String);
+        if (!reader) return;
+
+        StringRef str = token.asStringRef();
+        ptr->assign(str.data(), str.size());
+    }
+};
+
+template<>
+struct StringParser<StringRef> : public Parser
+{
+    Kind kind() const { return String; }
+
+    void parse(Reader& reader, Value& value) const
+    {
+        StringRef* ptr = target<StringRef>(reader, value);
+        if (!ptr) return;
+
+        Token token = reader.expectToken(Token::String);
+        if (reader) *ptr = reader.keep(token.asStringRef());
+    }
+};
+
+template<>
+struct StringParser<void> : public Parser
+{
+    Kind kind() const { return String; }
+
     void parse(Reader& reader, Value& value) const
     {
         value.assign(parseString(reader));
     }
 };
 
+Parser* basicParser(const Type* type)
+{
+    switch (type->kind()) {
+
+    case TypeKind::Bool: return new BoolParser<bool>;
+
+    case TypeKind::Char: return new IntParser<char>;
+    case TypeKind::SChar: return new IntParser<signed char>;
+    case TypeKind::UChar: return new IntParser<unsigned char>;
+    case TypeKind::Short: return new IntParser<short>;
+    case TypeKind::UShort: return new IntParser<unsigned short>;
+    case TypeKind::Int: return new IntParser<int>;
+    case TypeKind::UInt: return new IntParser<unsigned int>;
+    case TypeKind::Long: return new IntParser<long>;
+    case TypeKind::ULong: return new IntParser<unsigned long>;
+    case TypeKind::LongLong: return new IntParser<long long>;
+    case TypeKind::ULongLong: return new IntParser<unsigned long long>;
+
+    case TypeKind::Float: return new FloatParser<float>;
+    case TypeKind::Double: return new FloatParser<double>;
+    case TypeKind::LongDouble: return new FloatParser<long double>;
+
+    default: break;
+    }
+
+    if (type == reflect::type<std::string>()) return new StringParser<std::string>;
+    if (type == reflect::type<StringRef>()) return new StringParser<StringRef>;
+
+    if (type->is("bool")) return new BoolParser<>;
+    if (type->is("float")) return new FloatParser<>;
+    if (type->is("integer")) return new IntParser<>;
+    if (type->is("string")) return new StringParser<>;
+
+    return nullptr;
+}
+
+
+/******************************************************************************/
+/* HOOKS                                                                      */
+/******************************************************************************/
+
+// Pointers and containers that expose the in place insertion hooks have their
+// elements parsed directly into their final storage. The hooks are resolved
+// once and invoked without going through overload resolution.
+template<typename Fn>
+const Function* containerHook(const Type* type, const std::string& name)
+{
+    if (!type->hasFunction(name)) return nullptr;
+
+    const Overloads& fns = type->function(name);
+    return fns.test<Fn>() ? &fns.get<Fn>() : nullptr;
+}
+
+template<typename Fn>
+const Function* containerHook(const Type* type, Operator op)
+{
+    if (!type->hasFunction(op)) return nullptr;
+
+    const Overloads& fns = type->function(op);
+    return fns.test<Fn>() ? &fns.get<Fn>() : nullptr;
+}
+
+// Value arguments match any reference type so the overload of push_back that
+// takes its element by rvalue reference has to be picked by hand.
+const Function* pushHook(const Type* type, RefType refType)
+{
+    if (!type->hasFunction("push_back")) return nullptr;
+
+    const Function* hook = nullptr;
+    const Overloads& fns = type->function("push_back");
+
+    for (size_t i = 0; i < fns.size(); ++i) {
+        if (fns[i].arguments() != 2) continue;
+        if (!hook || fns[i].argument(1).refType() == refType) hook = &fns[i];
+    }
+
+    return hook;
+}
+
 
 /******************************************************************************/
 /* POINTER PARSER                                                             */
@@ -92,41 +266,63 @@ struct StringParser : public Parser
 
 struct PointerParser : public Parser
 {
+    Kind kind() const { return Pointer; }
+
     void init(const Type* type)
     {
         inner.init(type->pointee());
         isSmartPtr = type->is("smartPtr");
+
+        emplace = containerHook<Value(Value)>(type, "emplace");
+        arenaEmplace = containerHook<Value(Value, Arena&)>(type, "emplace");
     }
 
     void parse(Reader& reader, Value& ptr) const
     {
         if (reader.peekToken().type() == Token::Null) {
             reader.nextToken();
-
-            if (isSmartPtr) ptr.call<void>("reset");
-            else ptr = inner.type->construct();
-
+            reset(ptr);
             return;
         }
 
-        if (cast<bool>(ptr)) {
-            Value pointee = *ptr;
-            inner.parser->parse(reader, pointee);
-        }
+        Value value = pointee(reader, ptr);
+        inner.parser->parse(reader, value);
+    }
 
-        else {
-            Value value = inner.type->alloc();
-            Value pointee = *value;
-            inner.parser->parse(reader, pointee);
+    const TypeParser& target() const { return inner; }
 
-            if (isSmartPtr) ptr.call<void>("reset", value);
-            else ptr.assign(value);
-        }
+    void reset(Value& ptr) const
+    {
+        if (isSmartPtr) ptr.call<void>("reset");
+        else ptr = inner.type->construct();
+    }
+
+    // Allocates the pointee if the pointer is null. Shared pointers allocate
+    // their pointee along with their control block and from the reader's
+    // arena if it has one.
+    Value pointee(Reader& reader, Value& ptr) const
+    {
+        Value pointee = ptr.pointee();
+        if (!pointee.isVoid()) return pointee;
+
+        if (arenaEmplace && reader.arena())
+            return arenaEmplace->invoke<Value>(ptr, *reader.arena());
+        if (emplace) return emplace->invoke<Value>(ptr);
+
+        Value value = inner.type->alloc();
+
+        if (isSmartPtr) ptr.call<void>("reset", value);
+        else ptr.assign(value);
+
+        return *value;
     }
 
 private:
     TypeParser inner;
     bool isSmartPtr;
+
+    const Function* emplace;
+    const Function* arenaEmplace;
 };
 
 
@@ -136,27 +332,141 @@ private:
 
 struct ArrayParser : public Parser
 {
+    Kind kind() const { return Array; }
+
     void init(const Type* type)
     {
         inner.init(type->getValue<const Type*>("valueType"));
+
+        size = containerHook<size_t(Value)>(type, "size");
+        resize = containerHook<void(Value, size_t)>(type, "resize");
+        resizable = size && resize && type->hasFunction(Operator::Array);
+
+        push = pushHook(type, inner.movable ? RefType::RValue : RefType::LValue);
+
+        emplace = containerHook<Value(Value)>(type, "emplace_back");
+        pop = containerHook<void(Value)>(type, "pop_back");
+        if (!pop) emplace = nullptr;
+
+        reserve = containerHook<void(Value, size_t)>(type, "reserve");
+        index = containerHook<Value(Value, size_t)>(type, Operator::Array);
     }
 
     void parse(Reader& reader, Value& array) const
     {
+        if (resizable && parseInPlace(reader, array)) return;
+
+        if (index && resizable && reader.reuse() && !array.isConst()) {
+            parseReuse(reader, array);
+            return;
+        }
+
+        if (reserve && !array.isConst() && hint.get())
+            reserve->invoke<void>(array, hint.get());
+
+        size_t n = 0;
         auto onItem = [&] (size_t) {
-            Value item = inner.type->construct();
+            Value item = slot(array);
 
             inner.parser->parse(reader, item);
-            if (!reader) return;
+            if (!reader) return rollback(array, item);
 
-            if (inner.movable) item = item.rvalue();
-            array.call<void>("push_back", item);
+            commit(array, item);
+            n++;
         };
         parseArray(reader, onItem);
+
+        hint.update(n);
+    }
+
+    const TypeParser& item() const { return inner; }
+
+    // Returns the storage of the next element which must be handed back to
+    // commit once it's been parsed or to rollback if that failed.
+    Value slot(Value& array) const
+    {
+        if (emplace && !array.isConst()) return emplace->invoke<Value>(array);
+        return inner.type->construct();
+    }
+
+    void commit(Value& array, Value& item) const
+    {
+        if (!item.isStored()) return;
+
+        if (inner.movable) item = item.rvalue();
+
+        if (push) push->invoke<void>(array, item);
+        else array.call<void>("push_back", item);
+    }
+
+    void rollback(Value& array, Value& item) const
+    {
+        if (!item.isStored()) pop->invoke<void>(array);
     }
 
 private:
+
+    // Large top-level arrays are resized up front and their elements are
+    // parsed in place by several threads.
+    bool parseInPlace(Reader& reader, Value& array) const
+    {
+        if (!parallelCandidate(reader)) return false;
+
+        std::vector<Value> slots;
+
+        auto onResize = [&] (size_t n) {
+            size_t first = reader.reuse() ? 0 : size->invoke<size_t>(array);
+            resize->invoke<void>(array, first + n);
+
+            slots.reserve(n);
+            for (size_t i = 0; i < n; ++i) slots.push_back(array[first + i]);
+        };
+
+        auto onItem = [&] (Reader& reader, size_t i) {
+            inner.parser->parse(reader, slots[i]);
+        };
+
+        return parseParallel(reader, onResize, onItem);
+    }
+
+    // Overwrites the existing elements before appending new ones and then
+    // truncates the array to the size of the document.
+    void parseReuse(Reader& reader, Value& array) const
+    {
+        size_t existing = size->invoke<size_t>(array);
+
+        size_t n = 0;
+        auto onItem = [&] (size_t i) {
+            if (i < existing) {
+                Value item = index->invoke<Value>(array, i);
+                inner.parser->parse(reader, item);
+            }
+            else {
+                Value item = slot(array);
+
+                inner.parser->parse(reader, item);
+                if (!reader) return rollback(array, item);
+
+                commit(array, item);
+            }
+            n++;
+        };
+        parseArray(reader, onItem);
+
+        if (reader && n < existing) resize->invoke<void>(array, n);
+    }
+
     TypeParser inner;
+    bool resizable;
+
+    const Function* size;
+    const Function* resize;
+    const Function* push;
+    const Function* emplace;
+    const Function* pop;
+    const Function* reserve;
+    const Function* index;
+    mutable CapacityHint hint;
 };
 
 
@@ -166,30 +476,120 @@ private:
 
 struct MapParser : public Parser
 {
+    Kind kind() const { return Map; }
+
     void init(const Type* type)
     {
         inner.init(type->getValue<const Type*>("valueType"));
+
+        emplace = erase = count = subscript = nullptr;
+        if (type->getValue<const Type*>("keyType") == reflect::type<std::string>()) {
+            emplace = containerHook<Value(Value, const std::string&)>(type, "emplace");
+            erase = containerHook<size_t(Value, const std::string&)>(type, "erase");
+            count = containerHook<size_t(Value, const std::string&)>(type, "count");
+            subscript = containerHook<Value(Value, const std::string&)>(type, Operator::Array);
+            if (!erase || !count) emplace = nullptr;
+        }
+
+        size = containerHook<size_t(Value)>(type, "size");
+        reserve = containerHook<void(Value, size_t)>(type, "reserve");
+
+        index = nullptr;
+        if (emplace && size && type->hasFunction("keys")) index = subscript;
     }
 
     void parse(Reader& reader, Value& map) const
     {
-        // need to copy the key because we use the key only after we've parsed
-        // the value.
-        auto onField = [&] (std::string key) {
-            Value value = inner.type->construct();
+        if (index && reader.reuse() && !map.isConst()) {
+            parseReuse(reader, map);
+            return;
+        }
+
+        if (reserve && !map.isConst() && hint.get())
+            reserve->invoke<void>(map, hint.get());
+
+        size_t n = 0;
+        auto onField = [&] (StringRef name) {
+            std::string key = name.str();
+            Value value = slot(map, key);
 
             inner.parser->parse(reader, value);
-            if (!reader) return;
+            if (!reader) return rollback(map, key, value);
 
-            if (inner.movable) value = value.rvalue();
-            map[key].assign(value);
+            commit(map, key, value);
+            n++;
         };
         parseObject(reader, onField);
+
+        hint.update(n);
+    }
+
+    const TypeParser& item() const { return inner; }
+
+    // Returns the storage of the value at the key which must be handed back
+    // to commit once it's been parsed or to rollback if that failed. Only new
+    // keys are parsed in place so that a failure leaves existing values as
+    // they were.
+    Value slot(Value& map, const std::string& key) const
+    {
+        if (emplace && !map.isConst() && !count->invoke<size_t>(map, key))
+            return emplace->invoke<Value>(map, key);
+        return inner.type->construct();
     }
 
+    void commit(Value& map, const std::string& key, Value& value) const
+    {
+        if (!value.isStored()) return;
+
+        if (inner.movable) value = value.rvalue();
+
+        if (subscript) subscript->invoke<Value>(map, key).assign(value);
+        else map[key].assign(value);
+    }
+
+    void rollback(Value& map, const std::string& key, Value& value) const
+    {
+        if (!value.isStored()) erase->invoke<size_t>(map, key);
+    }
 
 private:
+
+    // Parses into the existing entries and then erases the ones that weren't
+    // in the document. Stale entries are detected by counting the keys so a
+    // document with duplicate keys can leave some of them behind.
+    void parseReuse(Reader& reader, Value& map) const
+    {
+        size_t mark = reader.keyMark();
+
+        size_t n = 0;
+        auto onField = [&] (StringRef name) {
+            Value value = index->invoke<Value>(map, reader.pushKey(name));
+
+            inner.parser->parse(reader, value);
+            if (reader) n++;
+        };
+        parseObject(reader, onField);
+
+        if (reader && size->invoke<size_t>(map) > n) {
+            reader.sortKeys(mark);
+
+            for (const auto& key : map.call< std::vector<std::string> >("keys"))
+                if (!reader.hasKey(mark, key)) erase->invoke<size_t>(map, key);
+        }
+
+        reader.popKeys(mark);
+    }
+
     TypeParser inner;
+
+    const Function* emplace;
+    const Function* erase;
+    const Function* count;
+    const Function* subscript;
+    const Function* size;
+    const Function* reserve;
+    const Function* index;
+    mutable CapacityHint hint;
 };
 
 
@@ -199,6 +599,24 @@ private:
 
 struct ObjectParser : public Parser
 {
+    struct Entry
+    {
+        std::string key;
+        std::string alias;
+        size_t offset;
+        bool isConst;
+        TypeParser inner;
+
+        // Mirrors Value::field without going through the field lookup.
+        Value field(const Value& obj) const
+        {
+            uint8_t* base = static_cast<uint8_t*>(obj.value());
+            return Value(inner.type, base + offset, isConst || obj.isConst());
+        }
+    };
+
+    Kind kind() const { return Object; }
+
     void init(const Type* type)
     {
         for (std::string key : type->fields()) {
@@ -211,40 +629,97 @@ struct ObjectParser : public Parser
                 if (!traits.alias.empty()) alias = traits.alias;
             }
 
-            if (keys.count(alias))
-                reflectError("duplicate json key <%s> in <%s>", alias, type->id());
-            keys[alias] = key;
+            Entry entry;
+            entry.key = key;
+            entry.alias = alias;
+            entry.offset = field.offset();
+            entry.isConst = field.argument().isConst();
+            entry.inner.init(field.type());
+            entries.push_back(std::move(entry));
+        }
 
-            TypeParser inner;
-            inner.init(field.type());
-            fields.emplace(key, inner);
+        // Entries are bucketed by the length of their alias which leaves only
+        // a handful of candidates to memcmp against for any given key.
+        std::sort(entries.begin(), entries.end(),
+                [] (const Entry& lhs, const Entry& rhs) {
+                    if (lhs.alias.size() != rhs.alias.size())
+                        return lhs.alias.size() < rhs.alias.size();
+                    return lhs.alias < rhs.alias;
+                });
+
+        for (size_t i = 1; i < entries.size(); ++i) {
+            if (entries[i - 1].alias != entries[i].alias) continue;
+            reflectError("duplicate json key <%s> in <%s>",
+                    entries[i].alias, type->id());
         }
+
+        size_t maxLength = entries.empty() ? 0 : entries.back().alias.size();
+        buckets.assign(maxLength + 2, 0);
+        for (const Entry& entry : entries) buckets[entry.alias.size() + 1]++;
+        for (size_t i = 1; i < buckets.size(); ++i) buckets[i] += buckets[i - 1];
+
+        successors.reset(new std::atomic<const Entry*>[entries.size() + 1]);
+        for (size_t i = 0; i <= entries.size(); ++i) successors[i] = nullptr;
     }
 
     void parse(Reader& reader, Value& obj) const
     {
-        auto onField = [&] (const std::string& alias) {
-            auto keyIt = keys.find(alias);
-            if (keyIt == keys.end()) {
+        size_t prev = entries.size();
+
+        auto onField = [&] (StringRef alias) {
+            const Entry* entry = predict(prev, alias);
+            if (!entry) {
                 skip(reader);
                 return;
             }
 
-            const std::string& key = keyIt->second;
-
-            auto fieldIt = fields.find(key);
-            if (fieldIt == fields.end())
-                reflectError("missing field <%s> for alias <%s>", key, alias);
+            prev = entry - entries.data();
 
-            Value field = obj.field(key);
-            fieldIt->second.parser->parse(reader, field);
+            Value field = entry->field(obj);
+            entry->inner.parser->parse(reader, field);
         };
         parseObject(reader, onField);
     }
 
+    const Entry* find(StringRef alias) const
+    {
+        size_t size = alias.size();
+        if (size + 1 >= buckets.size()) return nullptr;
+
+        for (size_t i = buckets[size]; i < buckets[size + 1]; ++i) {
+            const Entry& entry = entries[i];
+            if (!std::memcmp(entry.alias.data(), alias.data(), size)) return &entry;
+        }
+
+        return nullptr;
+    }
+
 private:
-    std::unordered_map<std::string, std::string> keys;
-    std::unordered_map<std::string, TypeParser> fields;
+
+    // Documents of the same type tend to list their keys in the same order so
+    // we remember which entry followed the previous one and check it first.
+    // The order is shared between threads; a stale prediction only costs a
+    // lookup.
+    const Entry* predict(size_t prev, StringRef alias) const
+    {
+        auto& successor = successors[prev];
+
+        const Entry* entry = successor.load(std::memory_order_relaxed);
+        if (entry && StringRef(entry->alias) == alias) return entry;
+
+        const Entry* found = find(alias);
+        if (found) successor.store(found, std::memory_order_relaxed);
+        return found;
+    }
+
+    std::vector<Entry> entries;
+
+    // Entries with an alias of length n are in [buckets[n], buckets[n + 1]).
+    std::vector<size_t> buckets;
+
+    // Entry which followed entries[i] in the last parsed object. The last slot
+    // is for the first key of the object.
+    std::unique_ptr<std::atomic<const Entry*>[]> successors;
 };
 
 
@@ -338,13 +813,9 @@ const Parser* getParser(const Type* type)
     auto it = parsers.find(type);
     if (it != parsers.end()) return it->second;
 
-    Parser* parser = nullptr;
-
-    if (type->is("bool")) parser = new BoolParser;
-    else if (type->is("float")) parser = new FloatParser;
-    else if (type->is("integer")) parser = new IntParser;
-    else if (type->is("string")) parser = new StringParser;
+    Parser* parser = basicParser(type);
 
+    if (parser);
     else if (type->isPointer()) parser = new PointerParser;
     else if (type->is("map")) parser = new MapParser;
     else if (type->is("list")) parser = new ArrayParser;
@@ -360,15 +831,26 @@ const Parser* getParser(const Type* type)
     return parser;
 }
 
+// Parsers are published on their type once fully initialized so the lock is
+// only taken the first time a type is parsed. Parsers reached while
+// initializing another are published on their own first top-level use since
+// recursive types can see them before they're complete.
 const Parser* getParserLocked(const Type* type)
 {
+    static const size_t slot = Type::cacheSlot();
+
+    const void* cached = type->cache(slot);
+    if (cached) return static_cast<const Parser*>(cached);
+
     static std::mutex mutex;
     std::lock_guard<std::mutex> guard(mutex);
 
-    return getParser(type);
+    const Parser* parser = getParser(type);
+    type->cache(slot, parser);
+    return parser;
 }
 
-} // namespace anonymous
+} // namespace details
 
 
 /******************************************************************************/
@@ -377,7 +859,7 @@ const Parser* getParserLocked(const Type* type)
 
 void parse(Reader& reader, Value& value)
 {
-    getParserLocked(value.type())->parse(reader, value);
+    details::getParserLocked(value.type())->parse(reader, value);
 }
 
 } // namespace json
@@ -390,5 +872,5 @@ void parse(Reader& reader, Value& value)
 // Since the ValueParser templated types are unlikely to show up in a reflection
 // somewhere, we therefore need to manually ensure that they're registered.
 
-reflectTypeLoader(reflect::json::ValueParser::ArrayT)
-reflectTypeLoader(reflect::json::ValueParser::ObjectT)
+reflectTypeLoader(reflect::json::details::ValueParser::ArrayT)
+reflectTypeLoader(reflect::json::details::ValueParser::ObjectT)
@@ -6,6 +6,8 @@
 #include "json.h"
 #pragma once
 
+#include <atomic>
+
 namespace reflect {
 namespace json {
 
@@ -20,6 +22,8 @@ inline bool parseBool(Reader& reader);
 inline int64_t parseInt(Reader& reader);
 inline double parseFloat(Reader& reader);
 inline std::string parseString(Reader& reader);
+template<typename T> void parseInt(Reader& reader, T& value);
+template<typename T> void parseFloat(Reader& reader, T& value);
 template<typename Fn> void parseObject(Reader& reader, const Fn& fn);
 template<typename Fn> void parseArray(Reader& reader, const Fn& fn);
 
@@ -31,7 +35,45 @@ template<typename Fn> void parseArray(Reader& reader, const Fn& fn);
 void parse(Reader& reader, Value& value);
 template<typename T> void parse(Reader& reader, T& value);
 template<typename T> Error parse(std::istream& stream, T& value);
+
+// Strings can be borrowed from the input which must then outlive the value.
 template<typename T> Error parse(const std::string& str, T& value);
+template<typename T> Error parse(std::string&&, T&) = delete;
+
+// Allocates the pointees of shared pointers and the strings of StringRef
+// fields that can't be borrowed from the input from the arena.
+template<typename T> Error parse(std::istream& stream, T& value, Arena& arena);
+template<typename T> Error parse(const std::string& str, T& value, Arena& arena);
+template<typename T> Error parse(std::string&&, T&, Arena&) = delete;
+
+
+/******************************************************************************/
+/* CAPACITY HINT                                                              */
+/******************************************************************************/
+
+namespace details {
+
+// Size of the last container parsed for a given type which is used to reserve
+// the storage of the next one. Capped so that a single large document doesn't
+// inflate every container that follows.
+struct CapacityHint
+{
+    enum { Max = 4096 };
+
+    CapacityHint() : value(0) {}
+
+    size_t get() const { return value.load(std::memory_order_relaxed); }
+
+    void update(size_t n)
+    {
+        value.store(n < Max ? n : size_t(Max), std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<size_t> value;
+};
+
+} // namespace details
 
 } // namespace json
 } // namespace reflect
@@ -44,6 +44,43 @@ std::string parseString(Reader& reader)
     return reader.expectToken(Token::String).asString();
 }
 
+namespace details {
+
+template<typename T>
+bool inRange(int64_t value)
+{
+    typedef std::numeric_limits<T> Limits;
+
+    if (Limits::is_signed)
+        return value >= int64_t(Limits::min()) && value <= int64_t(Limits::max());
+    return value >= 0 && uint64_t(value) <= uint64_t(Limits::max());
+}
+
+} // namespace details
+
+// Narrowing is range checked and out of range values are reported as errors
+// instead of being silently truncated.
+template<typename T>
+void parseInt(Reader& reader, T& value)
+{
+    int64_t result = parseInt(reader);
+    if (!reader) return;
+
+    if (details::inRange<T>(result)) value = T(result);
+    else reader.error("integer <%lld> out of range", (long long) result);
+}
+
+template<typename T>
+void parseFloat(Reader& reader, T& value)
+{
+    double result = parseFloat(reader);
+    if (!reader) return;
+
+    if (!std::isfinite(result) || std::abs(result) <= std::numeric_limits<T>::max())
+        value = T(result);
+    else reader.error("float <%g> out of range", result);
+}
+
 template<typename Fn>
 void parseObject(Reader& reader, const Fn& fn)
 {
@@ -58,8 +95,10 @@ void parseObject(Reader& reader, const Fn& fn)
     }
 
     while (reader) {
+        // The key is borrowed and only materialized if the callback takes
+        // an std::string.
         token = reader.expectToken(Token::String);
-        const std::string& key = token.asString();
+        StringRef key = token.asStringRef();
         token = reader.expectToken(Token::KeySeparator);
 
         fn(key);
@@ -93,7 +132,11 @@ void parseArray(Reader& reader, const Fn& fn)
 }
 
 
-void skip(Reader& reader)
+namespace details {
+
+// Children are normally handed back to skip but validating tokenizes the
+// entire value.
+inline void skipTokens(Reader& reader, bool validate = false)
 {
     Token token = reader.peekToken();
     if (!reader) return;
@@ -109,11 +152,17 @@ void skip(Reader& reader)
         break;
 
     case Token::ArrayStart:
-        parseArray(reader, [&] (size_t) { skip(reader); });
+        parseArray(reader, [&] (size_t) {
+                    if (validate) skipTokens(reader, true);
+                    else skip(reader);
+                });
         break;
 
     case Token::ObjectStart:
-        parseObject(reader, [&] (const std::string&) { skip(reader); });
+        parseObject(reader, [&] (StringRef) {
+                    if (validate) skipTokens(reader, true);
+                    else skip(reader);
+                });
         break;
 
     default:
@@ -123,6 +172,16 @@ void skip(Reader& reader)
     }
 }
 
+} // namespace details
+
+// Unknown values are skipped without being tokenized unless comments can hide
+// brackets or the next token was already consumed by a peek.
+void skip(Reader& reader)
+{
+    if (reader.allowComments() || reader.peeked()) details::skipTokens(reader);
+    else details::skipRaw(reader);
+}
+
 
 /******************************************************************************/
 /* VALUE PARSER                                                               */
@@ -131,8 +190,7 @@ void skip(Reader& reader)
 template<typename T>
 void parse(Reader& reader, T& value)
 {
-    Value v = cast<Value>(value);
-    parse(reader, v);
+    details::staticParse(reader, value);
 }
 
 template<typename T>
@@ -146,8 +204,27 @@ Error parse(std::istream& stream, T& value)
 template<typename T>
 Error parse(const std::string& str, T& value)
 {
-    std::istringstream stream(str);
-    return parse(stream, value);
+    Reader reader(str);
+    parse(reader, value);
+    return reader.error();
+}
+
+template<typename T>
+Error parse(std::istream& stream, T& value, Arena& arena)
+{
+    Reader reader(stream);
+    reader.arena(&arena);
+    parse(reader, value);
+    return reader.error();
+}
+
+template<typename T>
+Error parse(const std::string& str, T& value, Arena& arena)
+{
+    Reader reader(str);
+    reader.arena(&arena);
+    parse(reader, value);
+    return reader.error();
 }
 
 } // namespace json
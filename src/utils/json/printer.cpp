@@ -19,6 +19,16 @@ void printString(Writer& writer, const std::string& value)
     formatString(writer, value);
 }
 
+void printString(Writer& writer, StringRef value)
+{
+    formatString(writer, value);
+}
+
+void printString(Writer& writer, const char* value)
+{
+    formatString(writer, value);
+}
+
 void printBool(Writer& writer, const Value& value)
 {
     formatBool(writer, cast<bool>(value));
@@ -53,19 +63,6 @@ std::string customPrinter(const Type* type)
     return type->getValue<json::Traits>("json").printer;
 }
 
-bool isSkip(const Type* type)
-{
-    if (!type->is("json")) return false;
-    return type->getValue<json::Traits>("json").skip;
-}
-
-bool isSkipEmpty(const Writer& writer, const Type* type)
-{
-    if (writer.compact()) return true;
-    if (!type->is("json")) return false;
-    return type->getValue<json::Traits>("json").skipEmpty;
-}
-
 
 /******************************************************************************/
 /* PRINTER                                                                    */
@@ -139,15 +136,25 @@ struct FloatPrinter : public Printer
 
 struct StringPrinter : public Printer
 {
+    void init(const Type* type)
+    {
+        ref = type == reflect::type<StringRef>();
+    }
+
     bool isEmpty(const Value& value) const
     {
         return value.call<size_t>("size") == 0;
     }
 
+    // References are printed directly instead of going through a copy.
     void print(Writer& writer, const Value& value) const
     {
-        printString(writer, value);
+        if (ref) printString(writer, value.get<StringRef>());
+        else printString(writer, value);
     }
+
+private:
+    bool ref;
 };
 
 
@@ -161,17 +168,18 @@ struct PointerPrinter : public Printer
 
     bool isEmpty(const Value& ptr) const
     {
-        return !cast<bool>(ptr) || inner.printer->isEmpty(*ptr);
+        Value pointee = ptr.pointee();
+        return pointee.isVoid() || inner.printer->isEmpty(pointee);
     }
 
     void print(Writer& writer, const Value& ptr) const
     {
-        if (!cast<bool>(ptr)) {
+        Value pointee = ptr.pointee();
+        if (pointee.isVoid()) {
             printNull(writer);
             return;
         }
 
-        Value pointee = *ptr;
         inner.printer->print(writer, pointee);
     }
 
@@ -381,12 +389,20 @@ const Printer* getPrinter(const Type* type)
     return printer;
 }
 
+// Same publication scheme as getParserLocked.
 const Printer* getPrinterLocked(const Type* type)
 {
+    static const size_t slot = Type::cacheSlot();
+
+    const void* cached = type->cache(slot);
+    if (cached) return static_cast<const Printer*>(cached);
+
     static std::mutex mutex;
     std::lock_guard<std::mutex> guard(mutex);
 
-    return getPrinter(type);
+    const Printer* printer = getPrinter(type);
+    type->cache(slot, printer);
+    return printer;
 }
 
 } // namespace anonymous
@@ -401,5 +417,10 @@ void print(Writer& writer, const Value& value)
     getPrinterLocked(value.type())->print(writer, value);
 }
 
+bool details::isEmpty(const Value& value)
+{
+    return getPrinterLocked(value.type())->isEmpty(value);
+}
+
 } // namespace json
 } // namespace reflect
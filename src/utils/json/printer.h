@@ -17,6 +17,8 @@ void printBool(Writer& writer, bool value);
 void printInt(Writer& writer, int64_t value);
 void printFloat(Writer& writer, double value);
 void printString(Writer& writer, const std::string& value);
+void printString(Writer& writer, StringRef value);
+void printString(Writer& writer, const char* value);
 
 void printBool(Writer& writer, const Value& value);
 void printInt(Writer& writer, const Value& value);
@@ -45,5 +47,12 @@ template<typename T> Error print(Writer& writer, const T& value);
 template<typename T> Error print(std::ostream& stream, const T& value);
 template<typename T> std::pair<std::string, Error> print(const T& value);
 
+namespace details {
+
+// Whether the value would be skipped by a skipEmpty field or compact writer.
+bool isEmpty(const Value& value);
+
+} // namespace details
+
 } // namespace json
 } // namespace reflect
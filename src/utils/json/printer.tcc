@@ -105,8 +105,7 @@ void printArray(Writer& writer, size_t n, const PrintFn& printFn, const SkipFn&
 template<typename T>
 Error print(Writer& writer, const T& value)
 {
-    Value v = cast<Value>(value);
-    print(writer, v);
+    details::staticPrint(writer, value);
     return writer.error();
 }
 
@@ -114,7 +113,7 @@ template<typename T>
 Error print(std::ostream& stream, const T& value)
 {
     Writer writer(stream);
-    return parse(stream, value);
+    return print(writer, value);
 }
 
 template<typename T>
@@ -0,0 +1,296 @@
+/* projection.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include "json.h"
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* PROJECTION NODE                                                            */
+/******************************************************************************/
+
+// Children are keyed by the json key they match and hold the parser of the
+// value found under that key. Objects also remember the entry of the field so
+// that the field lookup is only done once per key.
+struct ProjectionNode
+{
+    ProjectionNode(const TypeParser& inner) :
+        inner(inner), entry(nullptr), leaf(false), id(0)
+    {}
+
+    TypeParser inner;
+    const ObjectParser::Entry* entry;
+
+    bool leaf;
+    size_t id;
+
+    std::vector< std::pair<std::string, ProjectionNode> > children;
+
+    const ProjectionNode* find(StringRef key) const
+    {
+        for (const auto& child : children)
+            if (StringRef(child.first) == key) return &child.second;
+        return nullptr;
+    }
+};
+
+namespace {
+
+std::vector<std::string> splitPath(const std::string& path)
+{
+    std::vector<std::string> keys;
+    if (path.empty()) return keys;
+
+    bool pointer = path[0] == '/';
+    char sep = pointer ? '/' : '.';
+
+    size_t start = pointer ? 1 : 0;
+    while (true) {
+        size_t end = path.find(sep, start);
+        std::string key = path.substr(start, end - start);
+
+        if (pointer) {
+            std::string unescaped;
+            for (size_t i = 0; i < key.size(); ++i) {
+                if (key[i] != '~') { unescaped += key[i]; continue; }
+
+                char c = i + 1 < key.size() ? key[++i] : 0;
+                if (c == '0') unescaped += '~';
+                else if (c == '1') unescaped += '/';
+                else reflectError("invalid escape in json pointer <%s>", path);
+            }
+            key = std::move(unescaped);
+        }
+
+        keys.push_back(std::move(key));
+        if (end == std::string::npos) break;
+        start = end + 1;
+    }
+
+    return keys;
+}
+
+// Pointers are transparent to paths.
+const Parser* deref(const Parser* parser)
+{
+    while (parser->kind() == Parser::Pointer)
+        parser = static_cast<const PointerParser*>(parser)->target().parser;
+    return parser;
+}
+
+void addPath(ProjectionNode& root, const std::string& path)
+{
+    ProjectionNode* node = &root;
+
+    for (const std::string& key : splitPath(path)) {
+        if (node->leaf) return;
+
+        auto it = std::find_if(node->children.begin(), node->children.end(),
+                [&] (const std::pair<std::string, ProjectionNode>& child) {
+                    return child.first == key;
+                });
+
+        if (it != node->children.end()) {
+            node = &it->second;
+            continue;
+        }
+
+        const Parser* parser = deref(node->inner.parser);
+        const ObjectParser::Entry* entry = nullptr;
+        const TypeParser* inner = nullptr;
+
+        if (parser->kind() == Parser::Object) {
+            entry = static_cast<const ObjectParser*>(parser)->find(key);
+            if (!entry) {
+                reflectError("unknown json key <%s> in <%s> for path <%s>",
+                        key, node->inner.type->id(), path);
+            }
+            inner = &entry->inner;
+        }
+
+        else if (parser->kind() == Parser::Map)
+            inner = &static_cast<const MapParser*>(parser)->item();
+
+        else {
+            reflectError("unable to select <%s> within <%s> for path <%s>",
+                    key, node->inner.type->id(), path);
+        }
+
+        node->children.emplace_back(key, ProjectionNode(*inner));
+        node = &node->children.back().second;
+        node->entry = entry;
+    }
+
+    // Selecting a value selects everything below it.
+    node->leaf = true;
+    node->children.clear();
+}
+
+size_t numberLeaves(ProjectionNode& node, size_t id)
+{
+    if (node.leaf) {
+        node.id = id;
+        return id + 1;
+    }
+
+    for (auto& child : node.children) id = numberLeaves(child.second, id);
+    return id;
+}
+
+
+/******************************************************************************/
+/* PROJECTION RUN                                                             */
+/******************************************************************************/
+
+struct ProjectionRun
+{
+    ProjectionRun(const Projection& projection) :
+        filled(projection.size(), false),
+        remaining(projection.size()),
+        validate(projection.options() & Projection::Validate)
+    {}
+
+    std::vector<bool> filled;
+    size_t remaining;
+    bool validate;
+
+    void fill(size_t id)
+    {
+        if (filled[id]) return;
+        filled[id] = true;
+        remaining--;
+    }
+
+    bool stop() const { return !remaining && !validate; }
+
+    void skip(Reader& reader) const
+    {
+        if (validate) skipTokens(reader, true);
+        else json::skip(reader);
+    }
+};
+
+void parseProjected(
+        Reader& reader,
+        Value& value,
+        const Parser* parser,
+        const ProjectionNode& node,
+        ProjectionRun& run)
+{
+    if (node.leaf) {
+        parser->parse(reader, value);
+        if (reader) run.fill(node.id);
+        return;
+    }
+
+    if (parser->kind() == Parser::Pointer) {
+        auto ptr = static_cast<const PointerParser*>(parser);
+
+        if (reader.peekToken().type() == Token::Null) {
+            reader.nextToken();
+            ptr->reset(value);
+            return;
+        }
+
+        Value pointee = ptr->pointee(reader, value);
+        parseProjected(reader, pointee, ptr->target().parser, node, run);
+        return;
+    }
+
+    // Mirrors parseObject but bails out as soon as every path is filled.
+    Token token = reader.nextToken();
+    if (token.type() == Token::Null) return;
+    reader.assertToken(token, Token::ObjectStart);
+
+    token = reader.peekToken();
+    if (token.type() == Token::ObjectEnd) {
+        reader.expectToken(Token::ObjectEnd);
+        return;
+    }
+
+    while (reader) {
+        token = reader.expectToken(Token::String);
+        StringRef key = token.asStringRef();
+        reader.expectToken(Token::KeySeparator);
+
+        const ProjectionNode* child = node.find(key);
+
+        if (!child) run.skip(reader);
+
+        else if (child->entry) {
+            Value field = child->entry->field(value);
+            parseProjected(reader, field, child->inner.parser, *child, run);
+        }
+
+        else {
+            auto map = static_cast<const MapParser*>(parser);
+
+            std::string name = key.str();
+            Value item = map->slot(value, name);
+
+            parseProjected(reader, item, child->inner.parser, *child, run);
+            if (reader) map->commit(value, name, item);
+            else map->rollback(value, name, item);
+        }
+
+        if (!reader || run.stop()) return;
+
+        token = reader.nextToken();
+        if (token.type() == Token::ObjectEnd) return;
+        reader.assertToken(token, Token::Separator);
+    }
+}
+
+} // namespace anonymous
+} // namespace details
+
+
+/******************************************************************************/
+/* PROJECTION                                                                 */
+/******************************************************************************/
+
+Projection::
+Projection(const Type* type, const std::vector<std::string>& paths, Options options) :
+    type_(type), options_(options), size_(0)
+{
+    details::TypeParser inner;
+    inner.movable = type->isMovable();
+    inner.type = type;
+    inner.parser = details::getParserLocked(type);
+
+    auto node = std::make_shared<details::ProjectionNode>(inner);
+    for (const std::string& path : paths) details::addPath(*node, path);
+
+    size_ = details::numberLeaves(*node, 0);
+    root = std::move(node);
+}
+
+
+/******************************************************************************/
+/* PARSE                                                                      */
+/******************************************************************************/
+
+void parse(Reader& reader, Value& value, const Projection& projection)
+{
+    if (value.type() != projection.type()) {
+        reflectError("projection for <%s> can't parse <%s>",
+                projection.type()->id(), value.type()->id());
+    }
+
+    details::ProjectionRun run(projection);
+
+    if (!projection.size()) {
+        if (run.validate) details::skipTokens(reader, true);
+        return;
+    }
+
+    const details::ProjectionNode& root = *projection.root;
+    details::parseProjected(reader, value, root.inner.parser, root, run);
+}
+
+} // namespace json
+} // namespace reflect
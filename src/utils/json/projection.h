@@ -0,0 +1,103 @@
+/* projection.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parsing of a subset of the fields of a document.
+
+   A projection is a set of paths compiled against the type being parsed. Paths
+   are either json pointers (/a/b with ~1 and ~0 escaping / and ~) or dotted
+   field names (a.b) and both refer to fields by their json alias. Objects,
+   maps and pointers can be descended into while any other value can only be
+   selected as a whole. The empty path selects the entire document.
+
+   Only the selected values are parsed into the target and everything else is
+   skipped without being decoded. Parsing stops as soon as every path has been
+   filled which leaves the rest of the input unread unless the projection asks
+   for the entire document to be validated.
+*/
+
+#include "json.h"
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace reflect {
+namespace json {
+
+namespace details { struct ProjectionNode; }
+
+
+/******************************************************************************/
+/* PROJECTION                                                                 */
+/******************************************************************************/
+
+struct Projection
+{
+    enum Options
+    {
+        None = 0,
+
+        // Keeps going once every path is filled and tokenizes everything that
+        // isn't selected so that the entire document is validated.
+        Validate = 1 << 0,
+    };
+
+    Projection(
+            const Type* type,
+            const std::vector<std::string>& paths,
+            Options options = None);
+
+    const Type* type() const { return type_; }
+    Options options() const { return options_; }
+
+    // Number of distinct values selected by the paths. A path that is a
+    // prefix of another selects the longer one as well.
+    size_t size() const { return size_; }
+
+private:
+    friend void parse(Reader& reader, Value& value, const Projection& projection);
+
+    const Type* type_;
+    Options options_;
+    size_t size_;
+
+    // Immutable once compiled so copies and threads can share it.
+    std::shared_ptr<const details::ProjectionNode> root;
+};
+
+
+/******************************************************************************/
+/* PARSE                                                                      */
+/******************************************************************************/
+
+void parse(Reader& reader, Value& value, const Projection& projection);
+
+template<typename T>
+void parse(Reader& reader, T& value, const Projection& projection)
+{
+    Value target = cast<Value>(value);
+    parse(reader, target, projection);
+}
+
+template<typename T>
+Error parse(std::istream& stream, T& value, const Projection& projection)
+{
+    Reader reader(stream);
+    parse(reader, value, projection);
+    return reader.error();
+}
+
+template<typename T>
+Error parse(const std::string& str, T& value, const Projection& projection)
+{
+    Reader reader(str);
+    parse(reader, value, projection);
+    return reader.error();
+}
+
+template<typename T>
+Error parse(std::string&&, T&, const Projection&) = delete;
+
+} // namespace json
+} // namespace reflect
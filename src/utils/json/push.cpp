@@ -0,0 +1,420 @@
+/* push.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* PUSH FRAME                                                                 */
+/******************************************************************************/
+
+struct PushFrame
+{
+    enum Kind { Root, Object, Map, Array, Raw, Skip };
+    enum State { ExpectFirst, ExpectKey, ExpectColon, ExpectValue, ExpectNext };
+
+    PushFrame(Kind kind, const Parser* parser, Value container) :
+        kind(kind), state(ExpectFirst),
+        parser(parser), container(std::move(container)),
+        slotParser(nullptr), depth(0)
+    {}
+
+    Kind kind;
+    State state;
+
+    // Parser of the container or of the captured value for raw frames.
+    const Parser* parser;
+    Value container;
+
+    // Target of the value currently being parsed within the container. A null
+    // parser means that the value is skipped.
+    Value slot;
+    const Parser* slotParser;
+    std::string key;
+
+    // Nesting depth and the captured bytes of raw and skip frames.
+    size_t depth;
+    std::string raw;
+
+    void item()
+    {
+        auto array = static_cast<const ArrayParser*>(parser);
+        slot = array->slot(container);
+        slotParser = array->item().parser;
+        state = ExpectValue;
+    }
+
+    void field(StringRef name)
+    {
+        state = ExpectColon;
+
+        if (kind == Map) {
+            auto map = static_cast<const MapParser*>(parser);
+            key = name.str();
+            slot = map->slot(container, key);
+            slotParser = map->item().parser;
+            return;
+        }
+
+        auto entry = static_cast<const ObjectParser*>(parser)->find(name);
+        slot = entry ? entry->field(container) : Value();
+        slotParser = entry ? entry->inner.parser : nullptr;
+    }
+
+    void commit()
+    {
+        if (kind == Array)
+            static_cast<const ArrayParser*>(parser)->commit(container, slot);
+
+        else if (kind == Map)
+            static_cast<const MapParser*>(parser)->commit(container, key, slot);
+
+        state = ExpectNext;
+    }
+};
+
+} // namespace details
+
+
+/******************************************************************************/
+/* PUSH PARSER                                                                */
+/******************************************************************************/
+
+using details::PushFrame;
+
+PushParser::
+PushParser(Value target, Reader::Options options) :
+    reader(nullptr, nullptr, Reader::Options(options & ~Reader::AllowComments)),
+    options(Reader::Options(options & ~Reader::AllowComments)),
+    done_(false), scan(ScanNone)
+{
+    stack.emplace_back(PushFrame::Root, nullptr, Value());
+    stack.back().state = PushFrame::ExpectValue;
+    stack.back().slotParser = details::getParserLocked(target.type());
+    stack.back().slot = std::move(target);
+}
+
+PushParser::
+~PushParser()
+{}
+
+Value
+PushParser::
+value() const
+{
+    return stack.front().slot;
+}
+
+size_t
+PushParser::
+feed(const char* data, size_t size)
+{
+    if (done_ || !reader) return 0;
+
+    const char* end = data + size;
+
+    if (partial.empty()) reader.feed(data, end);
+    else {
+        const char* last = scanToken(data, end, scan);
+        partial.append(data, last ? last : end);
+        if (!last) return size;
+
+        // The straddling token is tokenized out of its own block which
+        // doesn't throw off the location of errors.
+        const char* stop = partial.data() + partial.size();
+        reader.feed(partial.data(), stop);
+        next();
+
+        if (reader && reader.cursor() != stop)
+            reader.error("unexpected character <%c>", *reader.cursor());
+
+        reader.feed(last, end);
+        partial.clear();
+    }
+
+    while (!done_ && reader) {
+        const char* first = details::skipSpace(reader.cursor(), end);
+        reader.advance(first);
+        if (first == end) break;
+
+        scan = ScanNone;
+        if (!scanToken(first, end, scan)) {
+            partial.assign(first, end);
+            break;
+        }
+
+        next();
+    }
+
+    size_t consumed = partial.empty() ? reader.cursor() - data : size;
+    reader.feed(nullptr, nullptr);
+    return consumed;
+}
+
+void
+PushParser::
+finish()
+{
+    if (done_ || !reader) return;
+
+    if (!partial.empty() && scan == ScanScalar) {
+        reader.feed(partial.data(), partial.data() + partial.size());
+        next();
+        reader.feed(nullptr, nullptr);
+        partial.clear();
+    }
+
+    if (!done_) reader.error("unexpected end of input");
+}
+
+// Returns the end of the token which starts or continues at it or nullptr if
+// it continues past end in which case scan holds the state required to resume
+// the scan on the next chunk. Scalars are only complete once we've seen the
+// character that follows them.
+const char*
+PushParser::
+scanToken(const char* it, const char* end, Scan& scan)
+{
+    auto isScalar = [] (char c) {
+        return std::isalnum(uint8_t(c)) || c == '-' || c == '+' || c == '.';
+    };
+
+    if (scan == ScanNone) {
+        if (*it == '"') { scan = ScanString; ++it; }
+        else if (isScalar(*it)) scan = ScanScalar;
+        else return it + 1;
+    }
+
+    if (scan == ScanScalar) {
+        while (it != end && isScalar(*it)) ++it;
+        return it != end ? it : nullptr;
+    }
+
+    while (it != end) {
+        if (scan == ScanEscape) {
+            scan = ScanString;
+            ++it;
+            continue;
+        }
+
+        it = details::scanString(it, end, false);
+        if (it == end) break;
+
+        if (*it == '"') return it + 1;
+        if (*it == '\\') scan = ScanEscape;
+        ++it;
+    }
+
+    return nullptr;
+}
+
+// Consumes the token at the cursor of the reader which is known to be complete.
+void
+PushParser::
+next()
+{
+    PushFrame& frame = stack.back();
+
+    if (frame.kind == PushFrame::Raw || frame.kind == PushFrame::Skip) {
+        capture();
+        return;
+    }
+
+    bool array = frame.kind == PushFrame::Array;
+    Token::Type end = array ? Token::ArrayEnd : Token::ObjectEnd;
+
+    switch (frame.state) {
+
+    case PushFrame::ExpectFirst:
+        if (reader.peekToken().type() == end) {
+            reader.nextToken();
+            close();
+        }
+        else if (array) {
+            frame.item();
+            parseValue();
+        }
+        else parseKey();
+        break;
+
+    case PushFrame::ExpectKey: parseKey(); break;
+
+    case PushFrame::ExpectColon:
+        reader.expectToken(Token::KeySeparator);
+        frame.state = PushFrame::ExpectValue;
+        break;
+
+    case PushFrame::ExpectValue: parseValue(); break;
+
+    case PushFrame::ExpectNext: {
+        Token token = reader.nextToken();
+        if (token.type() == end) close();
+
+        else if (reader.assertToken(token, Token::Separator)) {
+            if (array) frame.item();
+            else frame.state = PushFrame::ExpectKey;
+        }
+        break;
+    }
+
+    }
+}
+
+void
+PushParser::
+parseKey()
+{
+    Token token = reader.expectToken(Token::String);
+    if (reader) stack.back().field(token.asStringRef());
+}
+
+void
+PushParser::
+parseValue()
+{
+    Value target = stack.back().slot;
+    const details::Parser* parser = stack.back().slotParser;
+
+    if (!parser) {
+        stack.emplace_back(PushFrame::Skip, nullptr, Value());
+        capture();
+        return;
+    }
+
+    // Pointers are resolved up front so that their pointee can be filled a
+    // token at a time.
+    while (parser->kind() == details::Parser::Pointer) {
+        auto pointer = static_cast<const details::PointerParser*>(parser);
+
+        if (reader.peekToken().type() == Token::Null) {
+            reader.nextToken();
+            pointer->reset(target);
+            complete();
+            return;
+        }
+
+        target = pointer->pointee(reader, target);
+        parser = pointer->target().parser;
+    }
+
+    switch (parser->kind()) {
+
+    case details::Parser::Array:
+    case details::Parser::Map:
+    case details::Parser::Object: {
+        bool array = parser->kind() == details::Parser::Array;
+
+        Token token = reader.nextToken();
+        if (token.type() == Token::Null) {
+            complete();
+            return;
+        }
+
+        if (!reader.assertToken(token, array ? Token::ArrayStart : Token::ObjectStart))
+            return;
+
+        PushFrame::Kind kind =
+            array ? PushFrame::Array :
+            parser->kind() == details::Parser::Map ? PushFrame::Map :
+            PushFrame::Object;
+
+        stack.emplace_back(kind, parser, target);
+        return;
+    }
+
+    case details::Parser::Opaque:
+        stack.emplace_back(PushFrame::Raw, parser, target);
+        capture();
+        return;
+
+    default:
+        parser->parse(reader, target);
+        if (reader) complete();
+        return;
+    }
+}
+
+// Opaque and skipped values are consumed a token at a time until the nesting
+// depth drops back to zero.
+void
+PushParser::
+capture()
+{
+    PushFrame& frame = stack.back();
+
+    const char* first = reader.cursor();
+    Token token = reader.nextToken();
+    if (!reader) return;
+
+    if (frame.kind == PushFrame::Raw) frame.raw.append(first, reader.cursor());
+
+    switch (token.type()) {
+
+    case Token::ObjectStart:
+    case Token::ArrayStart:
+        frame.depth++;
+        break;
+
+    case Token::ObjectEnd:
+    case Token::ArrayEnd:
+    case Token::Separator:
+    case Token::KeySeparator:
+        if (!frame.depth) {
+            reader.error("unexpected token %s", token.print());
+            return;
+        }
+
+        if (token.type() == Token::ObjectEnd || token.type() == Token::ArrayEnd)
+            frame.depth--;
+        break;
+
+    default: break;
+    }
+
+    if (frame.depth) return;
+
+    if (frame.kind == PushFrame::Raw) {
+        bool untyped = frame.container.isVoid();
+
+        // The capture is discarded once parsed so strings can't be borrowed
+        // from it and are copied into the arena of the push parser instead.
+        Reader sub(nullptr, nullptr, options);
+        sub.arena(reader.arena());
+        sub.feed(frame.raw.data(), frame.raw.data() + frame.raw.size());
+        frame.parser->parse(sub, frame.container);
+
+        if (sub.error()) {
+            reader.error("invalid value: %s", sub.error().what());
+            return;
+        }
+
+        // Untyped values are replaced rather than filled.
+        if (untyped) stack[stack.size() - 2].slot = frame.container;
+    }
+
+    close();
+}
+
+void
+PushParser::
+close()
+{
+    stack.pop_back();
+    complete();
+}
+
+void
+PushParser::
+complete()
+{
+    PushFrame& frame = stack.back();
+
+    if (frame.kind == PushFrame::Root) done_ = true;
+    else frame.commit();
+}
+
+} // namespace json
+} // namespace reflect
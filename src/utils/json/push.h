@@ -0,0 +1,87 @@
+/* push.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Resumable json parser for input that arrives in chunks.
+
+   Instead of pulling its input out of a blocking stream, the push parser is
+   handed chunks as they arrive and fills its target a token at a time. The
+   containers being parsed are tracked on an explicit stack so the parser can
+   stop anywhere, including in the middle of a token, and pick up where it left
+   off on the next chunk. Only a token that straddles two chunks is copied.
+
+   Types with a custom parser and untyped values can't be parsed a token at a
+   time so their bytes are gathered until the value is complete and then
+   handed to the regular parser. Comments are not supported.
+*/
+
+#include "json.h"
+#pragma once
+
+namespace reflect {
+namespace json {
+
+namespace details { struct PushFrame; }
+
+
+/******************************************************************************/
+/* PUSH PARSER                                                                */
+/******************************************************************************/
+
+struct PushParser
+{
+    explicit PushParser(Value target, Reader::Options options = Reader::Default);
+    ~PushParser();
+
+    PushParser(const PushParser&) = delete;
+    PushParser& operator=(const PushParser&) = delete;
+
+    // Consumes the chunk up to the end of the value and returns the number of
+    // bytes consumed. Anything left over is whatever follows the value in the
+    // input. A chunk doesn't need to outlive the call.
+    size_t feed(const char* data, size_t size);
+    size_t feed(const std::string& data) { return feed(data.data(), data.size()); }
+
+    // Signals the end of the input which is required to complete a top-level
+    // number since nothing else marks its end.
+    void finish();
+
+    bool done() const { return done_; }
+
+    // Arena for the pointees of shared pointers and the strings of StringRef
+    // fields which can't be borrowed from chunks. Must be set before feeding
+    // the first chunk.
+    void arena(Arena* arena) { reader.arena(arena); }
+
+    // The target or, if the target was void, the untyped value that was
+    // parsed.
+    Value value() const;
+
+    bool ok() const { return !reader.error(); }
+    operator bool() const { return ok(); }
+    const Error& error() const { return reader.error(); }
+
+private:
+
+    enum Scan { ScanNone, ScanString, ScanEscape, ScanScalar };
+    static const char* scanToken(const char* it, const char* end, Scan& scan);
+
+    void next();
+    void parseKey();
+    void parseValue();
+    void capture();
+    void close();
+    void complete();
+
+    Reader reader;
+    Reader::Options options;
+    bool done_;
+
+    Scan scan;
+    std::string partial;
+
+    std::vector<details::PushFrame> stack;
+};
+
+} // namespace json
+} // namespace reflect
@@ -0,0 +1,113 @@
+/* raw.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include "json.h"
+
+namespace reflect {
+namespace json {
+
+namespace {
+
+// A token that was already peeked is gone from the input so containers are
+// captured from their first byte onward and scalars are formatted back.
+void captureToken(Reader& reader, std::string& out)
+{
+    Token token = reader.nextToken();
+
+    switch (token.type()) {
+
+    case Token::ObjectStart:
+    case Token::ArrayStart:
+    {
+        out.push_back(token.type() == Token::ObjectStart ? '{' : '[');
+        reader.beginCapture(out);
+
+        size_t depth = 1;
+        while (reader && depth) {
+            token = reader.nextToken();
+            if (token.type() == Token::ObjectStart) depth++;
+            else if (token.type() == Token::ArrayStart) depth++;
+            else if (token.type() == Token::ObjectEnd) depth--;
+            else if (token.type() == Token::ArrayEnd) depth--;
+        }
+
+        reader.endCapture();
+        break;
+    }
+
+    case Token::Null:
+    case Token::Bool:
+    case Token::Int:
+    case Token::Float:
+    case Token::String:
+    {
+        std::ostringstream stream;
+        Writer writer(stream, Writer::None);
+
+        if (token.type() == Token::Null) formatNull(writer);
+        else if (token.type() == Token::Bool) formatBool(writer, token.asBool());
+        else if (token.type() == Token::Int) formatInt(writer, token.asInt());
+        else if (token.type() == Token::Float) formatFloat(writer, token.asFloat());
+        else formatString(writer, token.asStringRef());
+
+        out = stream.str();
+        break;
+    }
+
+    default:
+        reader.error("unable to capture token %s", token);
+        break;
+    }
+}
+
+} // namespace anonymous
+
+
+/******************************************************************************/
+/* RAW                                                                        */
+/******************************************************************************/
+
+void
+Raw::
+parseJson(Reader& reader)
+{
+    json_.clear();
+
+    if (reader.peeked()) captureToken(reader, json_);
+    else {
+        reader.beginCapture(json_);
+        skip(reader);
+        reader.endCapture();
+
+        // The capture starts at the cursor which can be followed by spaces.
+        size_t start = 0;
+        while (start < json_.size() && std::isspace(json_[start])) ++start;
+        json_.erase(0, start);
+    }
+
+    if (!reader) json_.clear();
+}
+
+void
+Raw::
+printJson(Writer& writer) const
+{
+    if (json_.empty()) printNull(writer);
+    else writer.push(json_);
+}
+
+} // namespace json
+} // namespace reflect
+
+
+reflectTypeImpl(reflect::json::Raw)
+{
+    reflectPlumbing();
+    reflectAlloc();
+
+    reflectFn(parseJson);
+    reflectFn(printJson);
+    reflectTypeValue(json, reflect::json::custom("parseJson", "printJson"));
+}
@@ -0,0 +1,118 @@
+/* raw.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Field types for subtrees that are passed through untouched.
+
+   A Raw captures the exact bytes of a value while it's being skipped and
+   splices them back as is when printed which avoids decoding and re-encoding
+   subtrees that are only forwarded. The bytes are neither re-indented nor
+   re-escaped according to the options of the writer.
+
+   A Lazy<T> also captures the bytes of its value but parses them into a T on
+   first access. It keeps printing the captured bytes until the value is
+   accessed through a non-const accessor, after which the value is printed
+   instead. The first access isn't thread-safe and fails on StringRef fields:
+   they can't borrow from the captured bytes which are relocated whenever the
+   Lazy is copied or moved and there's no arena to copy them into.
+*/
+
+#include "json.h"
+#pragma once
+
+#include "dsl/type.h"
+#include "dsl/template.h"
+#include "dsl/plumbing.h"
+#include "dsl/function.h"
+
+namespace reflect {
+namespace json {
+
+/******************************************************************************/
+/* RAW                                                                        */
+/******************************************************************************/
+
+struct Raw
+{
+    Raw() {}
+    explicit Raw(std::string json) : json_(std::move(json)) {}
+
+    // The bytes of the value which are empty if nothing was captured.
+    const std::string& json() const { return json_; }
+    bool empty() const { return json_.empty(); }
+    void clear() { json_.clear(); }
+
+    void parseJson(Reader& reader);
+    void printJson(Writer& writer) const;
+
+private:
+    std::string json_;
+};
+
+
+/******************************************************************************/
+/* LAZY                                                                       */
+/******************************************************************************/
+
+template<typename T>
+struct Lazy
+{
+    Lazy() : parsed(false), dirty(false) {}
+    Lazy(T value) : value(std::move(value)), parsed(true), dirty(true) {}
+
+    // Whether the captured bytes were parsed yet.
+    bool loaded() const { return parsed; }
+    const Raw& raw() const { return raw_; }
+
+    bool empty() const { return !dirty && raw_.empty(); }
+
+    const T& get() const { load(); return value; }
+    T& get() { load(); dirty = true; return value; }
+
+    const T& operator*() const { return get(); }
+    T& operator*() { return get(); }
+    const T* operator->() const { return &get(); }
+    T* operator->() { return &get(); }
+
+    void parseJson(Reader& reader);
+    void printJson(Writer& writer) const;
+
+private:
+    void load() const;
+
+    Raw raw_;
+    mutable T value;
+    mutable bool parsed;
+    bool dirty;
+};
+
+
+namespace details {
+
+/******************************************************************************/
+/* STATIC CODEC                                                               */
+/******************************************************************************/
+
+template<>
+struct StaticCodec<Raw>
+{
+    static void parse(Reader& reader, Raw& raw) { raw.parseJson(reader); }
+    static void print(Writer& writer, const Raw& raw) { raw.printJson(writer); }
+    static bool isEmpty(const Raw& raw) { return raw.empty(); }
+};
+
+template<typename T>
+struct StaticCodec< Lazy<T> >
+{
+    static void parse(Reader& reader, Lazy<T>& lazy) { lazy.parseJson(reader); }
+    static void print(Writer& writer, const Lazy<T>& lazy) { lazy.printJson(writer); }
+    static bool isEmpty(const Lazy<T>& lazy) { return lazy.empty(); }
+};
+
+} // namespace details
+
+} // namespace json
+} // namespace reflect
+
+reflectTypeDecl(reflect::json::Raw)
+reflectTemplateDecl(reflect::json::Lazy, T)
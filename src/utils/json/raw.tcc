@@ -0,0 +1,74 @@
+/* raw.tcc                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include "json.h"
+#pragma once
+
+namespace reflect {
+namespace json {
+
+/******************************************************************************/
+/* LAZY                                                                       */
+/******************************************************************************/
+
+template<typename T>
+void
+Lazy<T>::
+parseJson(Reader& reader)
+{
+    raw_.parseJson(reader);
+    parsed = dirty = false;
+}
+
+template<typename T>
+void
+Lazy<T>::
+printJson(Writer& writer) const
+{
+    if (!dirty && !raw_.empty()) raw_.printJson(writer);
+    else details::staticPrint(writer, value);
+}
+
+template<typename T>
+void
+Lazy<T>::
+load() const
+{
+    if (parsed) return;
+
+    value = T();
+
+    if (!raw_.empty()) {
+        // The value must not point into raw_ for copies and moves to be safe.
+        Reader reader(raw_.json());
+        reader.borrowable(false);
+        details::staticParse(reader, value);
+
+        if (reader.error()) {
+            reflectError("unable to parse <%s>: %s",
+                    typeId<T>(), reader.error().what());
+        }
+    }
+
+    parsed = true;
+}
+
+} // namespace json
+} // namespace reflect
+
+
+/******************************************************************************/
+/* REFLECT LAZY                                                               */
+/******************************************************************************/
+
+reflectTemplateImpl(reflect::json::Lazy, T)
+{
+    reflectPlumbing();
+    reflectAlloc();
+
+    reflectFn(parseJson);
+    reflectFn(printJson);
+    reflectTypeValue(json, reflect::json::custom("parseJson", "printJson"));
+}
@@ -12,6 +12,202 @@ namespace json {
 /* READER                                                                     */
 /******************************************************************************/
 
+Reader::
+Reader(const char* first, const char* last, Options options) :
+    stream(nullptr),
+    begin_(first), cur_(first), end_(last), eos_(false), borrowable_(true),
+    consumed_(0), lines_(0), lineStart_(0),
+    keysSize_(0), arena_(nullptr),
+    capture_(nullptr), captureStart_(nullptr),
+    options(options)
+{
+    buffer_.reserve(128);
+}
+
+Reader::
+Reader(const std::string& str, Options options) :
+    Reader(str.data(), str.data() + str.size(), options)
+{}
+
+Reader::
+Reader(std::istream& stream, Options options) :
+    stream(&stream),
+    begin_(nullptr), cur_(nullptr), end_(nullptr), eos_(false), borrowable_(false),
+    consumed_(0), lines_(0), lineStart_(0),
+    keysSize_(0), arena_(nullptr),
+    capture_(nullptr), captureStart_(nullptr),
+    options(options)
+{
+    buffer_.reserve(128);
+}
+
+bool
+Reader::
+refill()
+{
+    if (!stream || !*stream) return false;
+
+    if (capture_) capture_->append(captureStart_, end_);
+    discard(end_);
+
+    if (block.empty()) block.resize(BlockSize);
+    stream->read(block.data(), block.size());
+
+    begin_ = cur_ = captureStart_ = block.data();
+    end_ = begin_ + stream->gcount();
+
+    return cur_ != end_;
+}
+
+void
+Reader::
+feed(const char* first, const char* last)
+{
+    if (capture_) capture_->append(captureStart_, cur_);
+    discard(cur_);
+
+    begin_ = cur_ = captureStart_ = first;
+    end_ = last;
+    eos_ = false;
+    borrowable_ = false;
+}
+
+void
+Reader::
+reset(const char* first, const char* last)
+{
+    stream = nullptr;
+    begin_ = cur_ = first;
+    end_ = last;
+    borrowable_ = true;
+    restart();
+}
+
+void
+Reader::
+reset(const std::string& str)
+{
+    reset(str.data(), str.data() + str.size());
+}
+
+void
+Reader::
+reset(std::istream& stream)
+{
+    this->stream = &stream;
+    begin_ = cur_ = end_ = nullptr;
+    borrowable_ = false;
+    restart();
+}
+
+void
+Reader::
+restart()
+{
+    eos_ = false;
+    consumed_ = lines_ = lineStart_ = 0;
+
+    buffer_.clear();
+    error_ = Error();
+    token = Token();
+    keysSize_ = 0;
+    capture_ = nullptr;
+}
+
+// Folds the newlines of [begin_, it) into the totals so that line() and pos()
+// remain accurate once the block is gone.
+void
+Reader::
+discard(const char* it)
+{
+    for (const char* c = begin_; c != it; ++c) {
+        if (*c != '\n') continue;
+        lines_++;
+        lineStart_ = consumed_ + (c - begin_) + 1;
+    }
+    consumed_ += it - begin_;
+}
+
+size_t
+Reader::
+line() const
+{
+    return lines_ + 1 + std::count(begin_, cur_, '\n');
+}
+
+size_t
+Reader::
+pos() const
+{
+    size_t start = lineStart_;
+
+    for (const char* it = cur_; it != begin_; --it) {
+        if (it[-1] != '\n') continue;
+        start = consumed_ + (it - begin_);
+        break;
+    }
+
+    return offset() - start + 1;
+}
+
+// Unescaped strings always come out of the reader's buffer.
+StringRef
+Reader::
+keep(StringRef str)
+{
+    if (borrowable_ && str.data() != buffer_.data()) return str;
+
+    if (!arena_) {
+        error("string can't be borrowed from the input and no arena was provided");
+        return StringRef();
+    }
+
+    char* data = arena_->allocate<char>(str.size());
+    std::memcpy(data, str.data(), str.size());
+    return StringRef(data, str.size());
+}
+
+void
+Reader::
+beginCapture(std::string& out)
+{
+    capture_ = &out;
+    captureStart_ = cur_;
+}
+
+void
+Reader::
+endCapture()
+{
+    capture_->append(captureStart_, cur_);
+    capture_ = nullptr;
+}
+
+const std::string&
+Reader::
+pushKey(StringRef key)
+{
+    if (keysSize_ == keys_.size()) keys_.emplace_back();
+
+    std::string& slot = keys_[keysSize_++];
+    slot.assign(key.data(), key.size());
+    return slot;
+}
+
+void
+Reader::
+sortKeys(size_t mark)
+{
+    std::sort(keys_.begin() + mark, keys_.begin() + keysSize_);
+}
+
+bool
+Reader::
+hasKey(size_t mark, const std::string& key) const
+{
+    return std::binary_search(keys_.begin() + mark, keys_.begin() + keysSize_, key);
+}
+
 Token
 Reader::
 peekToken()
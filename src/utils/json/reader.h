@@ -22,27 +22,87 @@ struct Reader
         UnescapeUnicode = 1 << 1,
         ValidateUnicode = 1 << 2,
 
+        // Parses into the existing elements of arrays and maps instead of
+        // appending to them and then drops whatever the document didn't
+        // overwrite. Parsing the same shape of document over and over into
+        // the same object then reuses all of its storage. Fields and elements
+        // that are overwritten aren't reset first so objects keep the values
+        // of the fields missing from the document.
+        Reuse           = 1 << 3,
+
         None = 0,
         Default = UnescapeUnicode | ValidateUnicode,
     };
 
-    Reader(std::istream& stream, Options options = Default) :
-        stream(stream),
-        pos_(1), line_(1),
-        options(options)
-    {
-        buffer_.reserve(128);
-    }
+    enum { BlockSize = 64 * 1024 };
+
+    // Reads directly from a contiguous range which must outlive the reader.
+    Reader(const char* first, const char* last, Options options = Default);
+    explicit Reader(const std::string& str, Options options = Default);
+    Reader(std::string&&, Options = Default) = delete;
+
+    // Reads the stream in blocks of BlockSize bytes which means that the
+    // stream will usually be consumed past the end of the parsed value.
+    Reader(std::istream& stream, Options options = Default);
 
-    bool ok() const { return !error_ && stream; }
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    bool ok() const { return !error_ && !eos_; }
     operator bool() const { return ok(); }
 
     template<typename... Args>
     void error(const char* fmt, Args&&... args);
     const Error& error() const { return error_; }
 
-    char peek() { return stream.peek(); }
-    char pop() { pos_++; return stream.get(); }
+    // Adopts an error raised by another reader over the same input.
+    void error(Error error) { if (!error_) error_ = std::move(error); }
+
+    char peek()
+    {
+        if (cur_ == end_ && !refill()) return '\0';
+        return *cur_;
+    }
+
+    char pop()
+    {
+        if (cur_ == end_ && !refill()) { eos_ = true; return '\0'; }
+        return *cur_++;
+    }
+
+    // Raw access to the buffered input for the scanning loops of the
+    // tokenizer: [cursor(), end()) can be consumed with advance() and refill()
+    // must be called once it's empty. refill() returns false at the end of the
+    // input. [begin(), cursor()) is what was consumed of the current block.
+    const char* begin() const { return begin_; }
+    const char* cursor() const { return cur_; }
+    const char* end() const { return end_; }
+    void advance(const char* it) { cur_ = it; }
+    bool refill();
+
+    // The whole input is in memory and outlives the reader so tokens can
+    // reference it directly.
+    bool contiguous() const { return !stream; }
+
+    // Continues the input with a new contiguous range, discarding whatever
+    // wasn't consumed of the current one. Used by the push parser which
+    // hands over its input a chunk at a time.
+    void feed(const char* first, const char* last);
+
+    // Restarts the reader on a new contiguous range as if it had just been
+    // constructed but keeps its buffers around. Errors and positions are
+    // reported relative to the new range.
+    void reset(const char* first, const char* last);
+    void reset(const std::string& str);
+    void reset(std::string&&) = delete;
+
+    // Restarts the reader on a new stream. The block read from the previous
+    // stream is reused.
+    void reset(std::istream& stream);
+
+    // Whether a token was peeked but not consumed yet in which case the
+    // cursor is already past it.
+    bool peeked() const { return token.type() != Token::NoToken; }
 
     Token peekToken();
     Token nextToken();
@@ -50,24 +110,87 @@ struct Reader
     bool assertToken(const Token& token, Token::Type exp);
 
     void save(char c) { buffer_.push_back(c); }
+    void save(const char* first, const char* last) { buffer_.append(first, last); }
     const std::string& buffer() { return buffer_; }
     void resetBuffer() { buffer_.clear(); }
 
-    size_t pos() const { return pos_; }
-    size_t line() const { return line_; }
-    void newline() { pos_ = 1; line_++; }
+    // Position of the cursor in the input. The line and column are computed
+    // from the byte offset so they should only be used for diagnostics.
+    size_t offset() const { return consumed_ + (cur_ - begin_); }
+    size_t line() const;
+    size_t pos() const;
+
+    // Scratch keys for the maps parsed in Reuse mode. Keys are pushed as
+    // they're read and popped back to their mark once the map is done. The
+    // strings are recycled across maps and documents so that looking up an
+    // existing entry doesn't allocate.
+    size_t keyMark() const { return keysSize_; }
+    const std::string& pushKey(StringRef key);
+    void popKeys(size_t mark) { keysSize_ = mark; }
+
+    // Whether key was pushed since mark. Only valid after sortKeys(mark) and
+    // before the next push.
+    void sortKeys(size_t mark);
+    bool hasKey(size_t mark, const std::string& key) const;
 
     bool allowComments() const { return options & AllowComments; }
     bool unescapeUnicode() const { return options & UnescapeUnicode; }
     bool validateUnicode() const { return options & ValidateUnicode; }
+    bool reuse() const { return options & Reuse; }
+
+    // Arena from which the pointees of shared pointers are allocated, if
+    // any. The arena must outlive everything parsed while it was set.
+    Arena* arena() const { return arena_; }
+    void arena(Arena* arena) { arena_ = arena; }
+
+    // Returns a view of a string token that is valid for as long as the
+    // input. Strings borrowed from a contiguous input are returned as is while
+    // the others are copied into the arena. Without an arena, strings that
+    // can't be borrowed are reported as an error.
+    StringRef keep(StringRef str);
+
+    // Whether strings can be borrowed from the input. Inputs that don't
+    // outlive the parsed values, like a temporary mapping, should turn it off
+    // after every reset so that keep() copies everything into the arena.
+    bool borrowable() const { return borrowable_; }
+    void borrowable(bool value) { borrowable_ = value; }
+
+    // Appends every byte consumed between the two calls to out, including
+    // those of the blocks discarded along the way.
+    void beginCapture(std::string& out);
+    void endCapture();
 
 private:
-    std::istream& stream;
+    void discard(const char* it);
+    void restart();
+
+    std::istream* stream;
+    std::vector<char> block;
+
+    const char* begin_;
+    const char* cur_;
+    const char* end_;
+    bool eos_;
+
+    // Whether the input outlives the reader and can be borrowed from. Fed
+    // chunks don't.
+    bool borrowable_;
+
+    // Accounting for the blocks that were discarded by refill().
+    size_t consumed_;
+    size_t lines_;
+    size_t lineStart_;
+
     std::string buffer_;
     Error error_;
 
-    size_t pos_;
-    size_t line_;
+    std::vector<std::string> keys_;
+    size_t keysSize_;
+
+    Arena* arena_;
+
+    std::string* capture_;
+    const char* captureStart_;
 
     Options options;
 
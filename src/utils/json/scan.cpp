@@ -0,0 +1,690 @@
+/* scan.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#if defined(__x86_64__) || defined(__i386__)
+# define REFLECT_JSON_SIMD 1
+# include <immintrin.h>
+#endif
+
+namespace reflect {
+namespace json {
+namespace {
+
+/******************************************************************************/
+/* SCALAR                                                                     */
+/******************************************************************************/
+
+bool isSpaceByte(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+bool isStringStop(char c, bool stopOnHigh)
+{
+    if (c == '"' || c == '\\') return true;
+    if (c & 0x80) return stopOnHigh;
+    return c < 0x20;
+}
+
+const char* skipSpaceScalar(const char* it, const char* end)
+{
+    while (it != end && isSpaceByte(*it)) ++it;
+    return it;
+}
+
+const char* scanStringScalar(const char* it, const char* end, bool stopOnHigh)
+{
+    while (it != end && !isStringStop(*it, stopOnHigh)) ++it;
+    return it;
+}
+
+// Returns the end of the UTF-8 sequence starting at it or nullptr if it's
+// malformed or truncated.
+const char* nextUtf8(const char* it, const char* end)
+{
+    uint8_t c = *it;
+
+    size_t bytes = c >= 0xF8 ? 0 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 0;
+    if (!bytes || size_t(end - it) < bytes) return nullptr;
+
+    uint32_t code = c & (0x7F >> bytes);
+    for (size_t i = 1; i < bytes; ++i) {
+        uint8_t x = it[i];
+        if ((x & 0xC0) != 0x80) return nullptr;
+        code = (code << 6) | (x & 0x3F);
+    }
+
+    static const uint32_t min[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (code < min[bytes] || code > 0x10FFFF) return nullptr;
+    if (code >= 0xD800 && code <= 0xDFFF) return nullptr;
+
+    return it + bytes;
+}
+
+const char* validateUtf8Scalar(const char* it, const char* end)
+{
+    while (it != end) {
+        if (!(*it & 0x80)) { ++it; continue; }
+
+        const char* next = nextUtf8(it, end);
+        if (!next) return it;
+        it = next;
+    }
+
+    return end;
+}
+
+// Bitmasks of the interesting characters of a 64 bytes block where bit i
+// corresponds to byte i.
+struct BlockMasks
+{
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t op;
+};
+
+void classifyScalar(const char* it, BlockMasks& masks)
+{
+    masks = BlockMasks();
+
+    for (size_t i = 0; i < 64; ++i) {
+        uint64_t bit = uint64_t(1) << i;
+
+        switch (it[i]) {
+        case '"': masks.quote |= bit; break;
+        case '\\': masks.backslash |= bit; break;
+        case '{': case '}': case '[': case ']': case ',': case ':':
+            masks.op |= bit;
+            break;
+        }
+    }
+}
+
+
+#if REFLECT_JSON_SIMD
+
+/******************************************************************************/
+/* SSE2                                                                       */
+/******************************************************************************/
+// Bytes with the high bit set are negative under the signed comparaisons which
+// conveniently excludes them from the whitespace ranges and includes them in
+// the control character range.
+
+const char* skipSpaceSse2(const char* it, const char* end)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i lo = _mm_set1_epi8('\t' - 1);
+    const __m128i hi = _mm_set1_epi8('\r' + 1);
+
+    for (; end - it >= 16; it += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+        __m128i ws = _mm_or_si128(
+                _mm_cmpeq_epi8(x, space),
+                _mm_and_si128(_mm_cmpgt_epi8(x, lo), _mm_cmplt_epi8(x, hi)));
+
+        unsigned mask = ~_mm_movemask_epi8(ws) & 0xFFFF;
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return skipSpaceScalar(it, end);
+}
+
+const char* scanStringSse2(const char* it, const char* end, bool stopOnHigh)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('\\');
+    const __m128i ctrl = _mm_set1_epi8(0x20);
+    const __m128i neg = _mm_set1_epi8(-1);
+
+    for (; end - it >= 16; it += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+        __m128i stop = _mm_cmplt_epi8(x, ctrl);
+        if (!stopOnHigh) stop = _mm_and_si128(stop, _mm_cmpgt_epi8(x, neg));
+
+        stop = _mm_or_si128(stop, _mm_cmpeq_epi8(x, quote));
+        stop = _mm_or_si128(stop, _mm_cmpeq_epi8(x, slash));
+
+        unsigned mask = _mm_movemask_epi8(stop);
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return scanStringScalar(it, end, stopOnHigh);
+}
+
+// ASCII runs are skipped 16 bytes at a time and everything else is left to the
+// scalar decoder since SSE2 has no byte shuffle to classify sequences with.
+const char* validateUtf8Sse2(const char* it, const char* end)
+{
+    while (end - it >= 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+        unsigned mask = _mm_movemask_epi8(x);
+        if (!mask) { it += 16; continue; }
+
+        it += __builtin_ctz(mask);
+        const char* next = nextUtf8(it, end);
+        if (!next) return it;
+        it = next;
+    }
+
+    return validateUtf8Scalar(it, end);
+}
+
+// Brackets and braces only differ by 0x20 so they can be matched together
+// once that bit is set.
+void classifySse2(const char* it, BlockMasks& masks)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('\\');
+    const __m128i open = _mm_set1_epi8('{');
+    const __m128i close = _mm_set1_epi8('}');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i fold = _mm_set1_epi8(0x20);
+
+    masks = BlockMasks();
+
+    for (size_t i = 0; i < 64; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + i));
+        __m128i y = _mm_or_si128(x, fold);
+
+        __m128i op = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(y, open), _mm_cmpeq_epi8(y, close)),
+                _mm_or_si128(_mm_cmpeq_epi8(x, comma), _mm_cmpeq_epi8(x, colon)));
+
+        masks.quote |= uint64_t(_mm_movemask_epi8(_mm_cmpeq_epi8(x, quote))) << i;
+        masks.backslash |= uint64_t(_mm_movemask_epi8(_mm_cmpeq_epi8(x, slash))) << i;
+        masks.op |= uint64_t(_mm_movemask_epi8(op)) << i;
+    }
+}
+
+
+/******************************************************************************/
+/* AVX2                                                                       */
+/******************************************************************************/
+
+__attribute__((target("avx2")))
+const char* skipSpaceAvx2(const char* it, const char* end)
+{
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i lo = _mm256_set1_epi8('\t' - 1);
+    const __m256i hi = _mm256_set1_epi8('\r' + 1);
+
+    for (; end - it >= 32; it += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+
+        __m256i ws = _mm256_or_si256(
+                _mm256_cmpeq_epi8(x, space),
+                _mm256_and_si256(
+                        _mm256_cmpgt_epi8(x, lo), _mm256_cmpgt_epi8(hi, x)));
+
+        unsigned mask = ~unsigned(_mm256_movemask_epi8(ws));
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return skipSpaceSse2(it, end);
+}
+
+__attribute__((target("avx2")))
+const char* scanStringAvx2(const char* it, const char* end, bool stopOnHigh)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i slash = _mm256_set1_epi8('\\');
+    const __m256i ctrl = _mm256_set1_epi8(0x20);
+    const __m256i neg = _mm256_set1_epi8(-1);
+
+    for (; end - it >= 32; it += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+
+        __m256i stop = _mm256_cmpgt_epi8(ctrl, x);
+        if (!stopOnHigh) stop = _mm256_and_si256(stop, _mm256_cmpgt_epi8(x, neg));
+
+        stop = _mm256_or_si256(stop, _mm256_cmpeq_epi8(x, quote));
+        stop = _mm256_or_si256(stop, _mm256_cmpeq_epi8(x, slash));
+
+        unsigned mask = _mm256_movemask_epi8(stop);
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return scanStringSse2(it, end, stopOnHigh);
+}
+
+__attribute__((target("avx2")))
+void classifyAvx2(const char* it, BlockMasks& masks)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i slash = _mm256_set1_epi8('\\');
+    const __m256i open = _mm256_set1_epi8('{');
+    const __m256i close = _mm256_set1_epi8('}');
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i colon = _mm256_set1_epi8(':');
+    const __m256i fold = _mm256_set1_epi8(0x20);
+
+    masks = BlockMasks();
+
+    for (size_t i = 0; i < 64; i += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it + i));
+        __m256i y = _mm256_or_si256(x, fold);
+
+        __m256i op = _mm256_or_si256(
+                _mm256_or_si256(
+                        _mm256_cmpeq_epi8(y, open), _mm256_cmpeq_epi8(y, close)),
+                _mm256_or_si256(
+                        _mm256_cmpeq_epi8(x, comma), _mm256_cmpeq_epi8(x, colon)));
+
+        uint32_t quotes = _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, quote));
+        uint32_t slashes = _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, slash));
+        uint32_t ops = _mm256_movemask_epi8(op);
+
+        masks.quote |= uint64_t(quotes) << i;
+        masks.backslash |= uint64_t(slashes) << i;
+        masks.op |= uint64_t(ops) << i;
+    }
+}
+
+// Every error in a UTF-8 sequence can be detected by looking at a byte along
+// with the three that precede it. The high and low nibbles of the previous
+// byte and the high nibble of the current byte each index a table of the
+// errors they allow and an error is flagged when all three agree. The only
+// thing left is to check that the third and fourth bytes of the long
+// sequences are continuations. Blocks are chained through their last bytes
+// and, once a block fails, the scalar decoder finds the offending byte.
+namespace utf8 {
+
+enum : uint8_t
+{
+    TooShort = 1 << 0,     // 11______ 0_______ or 11______ 11______
+    TooLong = 1 << 1,      // 0_______ 10______
+    Overlong3 = 1 << 2,    // 11100000 100_____
+    TooLarge = 1 << 3,     // 11110100 1001____ or 11110100 101_____
+    Surrogate = 1 << 4,    // 11101101 101_____
+    Overlong2 = 1 << 5,    // 1100000_ 10______
+    TooLarge1000 = 1 << 6, // 11110101+ 1000____
+    Overlong4 = 1 << 6,    // 11110000 1000____
+    TwoConts = 1 << 7,     // 10______ 10______
+
+    // Errors which don't depend on the low nibble of the first byte.
+    Carry = TooShort | TooLong | TwoConts,
+};
+
+} // namespace utf8
+
+__attribute__((target("avx2")))
+__m256i table(
+        uint8_t x0, uint8_t x1, uint8_t x2, uint8_t x3,
+        uint8_t x4, uint8_t x5, uint8_t x6, uint8_t x7,
+        uint8_t x8, uint8_t x9, uint8_t xA, uint8_t xB,
+        uint8_t xC, uint8_t xD, uint8_t xE, uint8_t xF)
+{
+    return _mm256_broadcastsi128_si256(_mm_setr_epi8(
+                    x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, xA, xB, xC, xD, xE, xF));
+}
+
+// Byte i of the result is byte i - n of the concatenation of prev and x.
+template<int n>
+__attribute__((target("avx2")))
+__m256i shiftIn(__m256i x, __m256i prev)
+{
+    return _mm256_alignr_epi8(x, _mm256_permute2x128_si256(prev, x, 0x21), 16 - n);
+}
+
+__attribute__((target("avx2")))
+const char* validateUtf8Avx2(const char* first, const char* end)
+{
+    using namespace utf8;
+
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+    const __m256i byte1High = table(
+            TooLong, TooLong, TooLong, TooLong,
+            TooLong, TooLong, TooLong, TooLong,
+            TwoConts, TwoConts, TwoConts, TwoConts,
+            TooShort | Overlong2,
+            TooShort,
+            TooShort | Overlong3 | Surrogate,
+            TooShort | TooLarge | TooLarge1000 | Overlong4);
+
+    const __m256i byte1Low = table(
+            Carry | Overlong3 | Overlong2 | Overlong4,
+            Carry | Overlong2,
+            Carry,
+            Carry,
+            Carry | TooLarge,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000 | Surrogate,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000);
+
+    const __m256i byte2High = table(
+            TooShort, TooShort, TooShort, TooShort,
+            TooShort, TooShort, TooShort, TooShort,
+            TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+            TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+            TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+            TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+            TooShort, TooShort, TooShort, TooShort);
+
+    // Lead bytes in the last three bytes of a block whose sequence must
+    // continue into the next block.
+    const __m256i incompleteMax = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            char(0xF0 - 1), char(0xE0 - 1), char(0xC0 - 1));
+
+    __m256i prev = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+
+    const char* it = first;
+    for (; end - it >= 32; it += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+        __m256i error;
+
+        if (!_mm256_movemask_epi8(x)) {
+            error = incomplete;
+            incomplete = _mm256_setzero_si256();
+        }
+        else {
+            __m256i prev1 = shiftIn<1>(x, prev);
+            __m256i prev2 = shiftIn<2>(x, prev);
+            __m256i prev3 = shiftIn<3>(x, prev);
+
+            __m256i special = _mm256_and_si256(
+                    _mm256_and_si256(
+                            _mm256_shuffle_epi8(byte1High,
+                                    _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                            _mm256_shuffle_epi8(byte1Low, _mm256_and_si256(prev1, nibble))),
+                    _mm256_shuffle_epi8(byte2High,
+                            _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble)));
+
+            // Only 111_____ and 1111____ end up with their high bit set.
+            __m256i continuation = _mm256_or_si256(
+                    _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+                    _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80)));
+            continuation = _mm256_and_si256(continuation, _mm256_set1_epi8(char(0x80)));
+
+            error = _mm256_xor_si256(continuation, special);
+            incomplete = _mm256_subs_epu8(x, incompleteMax);
+        }
+
+        if (!_mm256_testz_si256(error, error)) break;
+        prev = x;
+    }
+
+    // Resumes from the start of the sequence that straddles the block, if any.
+    const char* start = it;
+    for (size_t i = 1; i <= 3 && i <= size_t(it - first); ++i) {
+        char c = *(it - i);
+        if ((c & 0xC0) == 0x80) continue;
+        if (c & 0x80) start = it - i;
+        break;
+    }
+
+    return validateUtf8Scalar(start, end);
+}
+
+#endif // REFLECT_JSON_SIMD
+
+
+/******************************************************************************/
+/* STRUCTURAL INDEX                                                           */
+/******************************************************************************/
+
+// Bits of the block which are escaped by a backslash. A run of backslashes
+// escapes the character that follows it if it's of odd length which is found
+// by adding the start of the odd runs to the runs: the carry then lands just
+// past the end of the runs that started on an even bit. carry tracks whether
+// the first byte of the next block is escaped.
+uint64_t escapedMask(uint64_t backslash, uint64_t& carry)
+{
+    const uint64_t even = 0x5555555555555555ULL;
+
+    backslash &= ~carry;
+    uint64_t follows = backslash << 1 | carry;
+    uint64_t oddStarts = backslash & ~even & ~follows;
+
+    uint64_t evenRuns;
+    carry = __builtin_add_overflow(oddStarts, backslash, &evenRuns);
+
+    return (even ^ (evenRuns << 1)) & follows;
+}
+
+// Each bit becomes the xor of itself and every bit below it which turns the
+// quote mask into the mask of the bytes within strings.
+uint64_t prefixXor(uint64_t x)
+{
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+template<void (*Classify)(const char*, BlockMasks&)>
+void indexStructurals(const char* first, const char* last, std::vector<uint32_t>& index)
+{
+    uint64_t escaped = 0;
+    uint64_t inString = 0;
+    char tail[64];
+
+    for (const char* it = first; it < last; it += 64) {
+        const char* block = it;
+
+        // The tail is padded with spaces which aren't structural.
+        if (last - it < 64) {
+            std::memset(tail, ' ', sizeof(tail));
+            std::memcpy(tail, it, last - it);
+            block = tail;
+        }
+
+        BlockMasks masks;
+        Classify(block, masks);
+
+        uint64_t quotes = masks.quote & ~escapedMask(masks.backslash, escaped);
+        uint64_t strings = prefixXor(quotes) ^ inString;
+        inString = uint64_t(int64_t(strings) >> 63);
+
+        uint64_t structurals = masks.op & ~strings;
+        uint32_t base = it - first;
+
+        while (structurals) {
+            index.push_back(base + __builtin_ctzll(structurals));
+            structurals &= structurals - 1;
+        }
+    }
+}
+
+
+/******************************************************************************/
+/* SKIP NESTED                                                                */
+/******************************************************************************/
+
+// Brackets and braces only differ by 0x20.
+bool isOpen(char c) { return (c | 0x20) == '{'; }
+bool isClose(char c) { return (c | 0x20) == '}'; }
+
+const char* skipNestedScalar(const char* it, const char* end, details::SkipState& state)
+{
+    for (; it != end; ++it) {
+        char c = *it;
+
+        if (state.escaped) state.escaped = false;
+        else if (c == '\\') state.escaped = true;
+        else if (c == '"') state.inString = !state.inString;
+        else if (state.inString) continue;
+        else if (isOpen(c)) state.depth++;
+        else if (isClose(c) && !--state.depth) return it + 1;
+    }
+
+    return end;
+}
+
+// Same quote and escape tracking as the structural index but only the
+// brackets and braces of each block are walked.
+template<void (*Classify)(const char*, BlockMasks&)>
+const char* skipNested(const char* it, const char* end, details::SkipState& state)
+{
+    for (; end - it >= 64; it += 64) {
+        BlockMasks masks;
+        Classify(it, masks);
+
+        uint64_t carry = state.escaped;
+        uint64_t escaped = escapedMask(masks.backslash, carry);
+        uint64_t quotes = masks.quote & ~escaped;
+        uint64_t strings = prefixXor(quotes) ^ (state.inString ? ~uint64_t(0) : 0);
+
+        uint64_t ops = masks.op & ~strings & ~escaped;
+        while (ops) {
+            const char* op = it + __builtin_ctzll(ops);
+            ops &= ops - 1;
+
+            if (isOpen(*op)) state.depth++;
+            else if (isClose(*op) && !--state.depth) {
+                state.escaped = state.inString = false;
+                return op + 1;
+            }
+        }
+
+        state.escaped = carry;
+        state.inString = strings >> 63;
+    }
+
+    return skipNestedScalar(it, end, state);
+}
+
+
+/******************************************************************************/
+/* KERNELS                                                                    */
+/******************************************************************************/
+
+struct Kernels
+{
+    ScanIsa isa;
+    const char* (*skipSpace)(const char*, const char*);
+    const char* (*scanString)(const char*, const char*, bool);
+    void (*indexStructurals)(const char*, const char*, std::vector<uint32_t>&);
+    const char* (*skipNested)(const char*, const char*, details::SkipState&);
+    const char* (*validateUtf8)(const char*, const char*);
+};
+
+const Kernels scalarKernels = {
+    ScanIsa::Scalar, &skipSpaceScalar, &scanStringScalar,
+    &indexStructurals<&classifyScalar>, &skipNested<&classifyScalar>,
+    &validateUtf8Scalar };
+
+#if REFLECT_JSON_SIMD
+const Kernels sse2Kernels = {
+    ScanIsa::Sse2, &skipSpaceSse2, &scanStringSse2,
+    &indexStructurals<&classifySse2>, &skipNested<&classifySse2>,
+    &validateUtf8Sse2 };
+
+const Kernels avx2Kernels = {
+    ScanIsa::Avx2, &skipSpaceAvx2, &scanStringAvx2,
+    &indexStructurals<&classifyAvx2>, &skipNested<&classifyAvx2>,
+    &validateUtf8Avx2 };
+#endif
+
+const Kernels* kernelsFor(ScanIsa isa)
+{
+    switch (isa) {
+    case ScanIsa::Scalar: return &scalarKernels;
+#if REFLECT_JSON_SIMD
+    case ScanIsa::Sse2: return &sse2Kernels;
+    case ScanIsa::Avx2: return &avx2Kernels;
+#endif
+    default: return nullptr;
+    }
+}
+
+std::atomic<const Kernels*> currentKernels(nullptr);
+
+const Kernels* kernels()
+{
+    const Kernels* result = currentKernels.load(std::memory_order_relaxed);
+    if (result) return result;
+
+    result = &scalarKernels;
+    if (scanSupported(ScanIsa::Avx2)) result = kernelsFor(ScanIsa::Avx2);
+    else if (scanSupported(ScanIsa::Sse2)) result = kernelsFor(ScanIsa::Sse2);
+
+    currentKernels.store(result, std::memory_order_relaxed);
+    return result;
+}
+
+} // namespace anonymous
+
+
+/******************************************************************************/
+/* SCAN ISA                                                                   */
+/******************************************************************************/
+
+bool scanSupported(ScanIsa isa)
+{
+    switch (isa) {
+    case ScanIsa::Scalar: return true;
+#if REFLECT_JSON_SIMD
+    case ScanIsa::Sse2: return __builtin_cpu_supports("sse2");
+    case ScanIsa::Avx2: return __builtin_cpu_supports("avx2");
+#endif
+    default: return false;
+    }
+}
+
+ScanIsa scanIsa()
+{
+    return kernels()->isa;
+}
+
+void scanIsa(ScanIsa isa)
+{
+    if (!scanSupported(isa))
+        reflectError("scan isa <%u> is not supported", unsigned(isa));
+
+    currentKernels.store(kernelsFor(isa), std::memory_order_relaxed);
+}
+
+
+/******************************************************************************/
+/* SCAN                                                                       */
+/******************************************************************************/
+
+const char* details::skipSpace(const char* it, const char* end)
+{
+    return kernels()->skipSpace(it, end);
+}
+
+const char* details::scanString(const char* it, const char* end, bool stopOnHigh)
+{
+    return kernels()->scanString(it, end, stopOnHigh);
+}
+
+const char* details::skipNested(const char* it, const char* end, SkipState& state)
+{
+    return kernels()->skipNested(it, end, state);
+}
+
+const char* details::validateUtf8(const char* it, const char* end)
+{
+    return kernels()->validateUtf8(it, end);
+}
+
+void details::indexStructurals(
+        const char* first, const char* last, std::vector<uint32_t>& index)
+{
+    kernels()->indexStructurals(first, last, index);
+}
+
+} // namespace json
+} // namespace reflect
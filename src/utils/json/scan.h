@@ -0,0 +1,78 @@
+/* scan.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Vectorized scanning kernels used by the tokenizer and by the structural
+   index of the parallel array parser.
+
+   Each kernel classifies 16 (SSE2) or 32 (AVX2) bytes at a time and has a
+   scalar equivalent which is used for the tail of the buffer and on
+   platforms without SIMD support. The best kernel available on the running
+   CPU is selected on first use.
+*/
+
+#include "json.h"
+#pragma once
+
+namespace reflect {
+namespace json {
+
+/******************************************************************************/
+/* SCAN ISA                                                                   */
+/******************************************************************************/
+
+enum struct ScanIsa { Scalar, Sse2, Avx2 };
+
+bool scanSupported(ScanIsa isa);
+
+// The kernel set currently in use. Can be overriden to test or benchmark a
+// specific kernel; the ISA must be supported by the CPU.
+ScanIsa scanIsa();
+void scanIsa(ScanIsa isa);
+
+
+namespace details {
+
+/******************************************************************************/
+/* SCAN                                                                       */
+/******************************************************************************/
+
+// Returns the first byte of [it, end) which isn't whitespace as defined by
+// std::isspace in the C locale or end if there are none.
+const char* skipSpace(const char* it, const char* end);
+
+// Returns the first byte of [it, end) which requires special handling within
+// a string: a quote, a backslash, a control character or, if stopOnHigh is
+// set, a non-ASCII byte. Returns end if there are none.
+const char* scanString(const char* it, const char* end, bool stopOnHigh);
+
+// Returns the first byte of [it, end) which doesn't belong to a well-formed
+// UTF-8 sequence, including a sequence cut short by end, or end if the entire
+// range is valid. Overlong encodings, surrogates and code points above
+// U+10FFFF are rejected. The range must start on a character boundary.
+const char* validateUtf8(const char* it, const char* end);
+
+// Nesting state of a raw skip over a value which can span several buffers.
+struct SkipState
+{
+    SkipState(size_t depth = 0) : depth(depth), inString(false), escaped(false) {}
+
+    size_t depth;
+    bool inString;
+    bool escaped; // The next byte is escaped by a backslash.
+};
+
+// Tracks the nesting of brackets and braces outside of strings through
+// [it, end) and returns one past the byte which brings the depth down to zero
+// or end if it's not reached within the range. Nothing else is validated and
+// brackets and braces are not matched against each other.
+const char* skipNested(const char* it, const char* end, SkipState& state);
+
+// Appends the offset from first of every structural character ({}[],:) of
+// [first, last) which isn't within a string. The range must start outside of
+// a string and be smaller than 4GB.
+void indexStructurals(const char* first, const char* last, std::vector<uint32_t>& index);
+
+} // namespace details
+} // namespace json
+} // namespace reflect
@@ -0,0 +1,45 @@
+/* static.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* STATIC OBJECT                                                              */
+/******************************************************************************/
+
+bool staticObject(const Type* type, size_t fields)
+{
+    if (type->is("json")) {
+        auto traits = type->getValue<Traits>("json");
+        if (!traits.parser.empty() || !traits.printer.empty()) return false;
+    }
+
+    return type->fields().size() == fields;
+}
+
+bool staticField(const Type* type, const std::string& name,
+        std::string& alias, bool& skipEmpty)
+{
+    const Field& field = type->field(name);
+
+    alias = name;
+    skipEmpty = false;
+
+    if (!field.is("json")) return true;
+
+    auto traits = field.getValue<Traits>("json");
+    if (traits.skip) return false;
+
+    if (!traits.alias.empty()) alias = traits.alias;
+    skipEmpty = traits.skipEmpty;
+
+    return true;
+}
+
+} // namespace details
+} // namespace json
+} // namespace reflect
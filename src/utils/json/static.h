@@ -0,0 +1,532 @@
+/* static.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Statically specialized json codec.
+
+   json::parse<T> and json::print<T> pick a codec at compile time: primitives,
+   strings, vectors, string-keyed maps and smart pointers are handled directly
+   while objects described by reflectStaticFields (see dsl/static.h) access
+   their fields through member pointers. Anything else is boxed in a Value and
+   handed to the dynamic codec which is also used as the reference for the
+   output: both paths must produce the exact same results.
+
+   Aliases and skips still come from the json traits of the runtime fields so
+   an object's key table is built on first use. An object whose runtime
+   reflection doesn't match its static description (extra fields or a custom
+   parser) falls back to the dynamic codec.
+*/
+
+#include "json.h"
+#pragma once
+
+#include "dsl/basics.h"
+#include "dsl/static.h"
+
+#include <map>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+namespace reflect {
+namespace json {
+namespace details {
+
+/******************************************************************************/
+/* STATIC CODEC                                                               */
+/******************************************************************************/
+
+template<typename T>
+struct DynamicCodec
+{
+    static void parse(Reader& reader, T& value)
+    {
+        Value v = cast<Value>(value);
+        json::parse(reader, v);
+    }
+
+    static void print(Writer& writer, const T& value)
+    {
+        Value v = cast<Value>(value);
+        json::print(writer, v);
+    }
+
+    static bool isEmpty(const T& value)
+    {
+        return details::isEmpty(cast<Value>(value));
+    }
+};
+
+// Types without a static codec are boxed and handed to the dynamic codec.
+template<typename T, typename Enable = void>
+struct StaticCodec : public DynamicCodec<T> {};
+
+template<typename T>
+void staticParse(Reader& reader, T& value)
+{
+    StaticCodec<T>::parse(reader, value);
+}
+
+template<typename T>
+void staticPrint(Writer& writer, const T& value)
+{
+    StaticCodec<T>::print(writer, value);
+}
+
+template<typename T>
+bool staticIsEmpty(const T& value)
+{
+    return StaticCodec<T>::isEmpty(value);
+}
+
+
+/******************************************************************************/
+/* PRIMITIVES                                                                 */
+/******************************************************************************/
+
+template<>
+struct StaticCodec<bool>
+{
+    static void parse(Reader& reader, bool& value) { value = parseBool(reader); }
+    static void print(Writer& writer, bool value) { printBool(writer, value); }
+    static bool isEmpty(bool) { return false; }
+};
+
+template<typename T>
+struct StaticCodec<T, typename std::enable_if<
+        std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+{
+    static void parse(Reader& reader, T& value) { parseInt(reader, value); }
+    static void print(Writer& writer, T value) { printInt(writer, int64_t(value)); }
+    static bool isEmpty(T value) { return value == 0; }
+};
+
+template<typename T>
+struct StaticCodec<T, typename std::enable_if<
+        std::is_floating_point<T>::value>::type>
+{
+    static void parse(Reader& reader, T& value) { parseFloat(reader, value); }
+    static void print(Writer& writer, T value) { printFloat(writer, double(value)); }
+    static bool isEmpty(T value) { return value == 0; }
+};
+
+template<>
+struct StaticCodec<std::string>
+{
+    // Assigned from the token so that the capacity of the string is reused.
+    static void parse(Reader& reader, std::string& value)
+    {
+        Token token = reader.expectToken(Token::String);
+        if (!reader) return;
+
+        StringRef str = token.asStringRef();
+        value.assign(str.data(), str.size());
+    }
+
+    static void print(Writer& writer, const std::string& value)
+    {
+        printString(writer, value);
+    }
+
+    static bool isEmpty(const std::string& value) { return value.empty(); }
+};
+
+template<>
+struct StaticCodec<StringRef>
+{
+    static void parse(Reader& reader, StringRef& value)
+    {
+        Token token = reader.expectToken(Token::String);
+        if (reader) value = reader.keep(token.asStringRef());
+    }
+
+    static void print(Writer& writer, StringRef value)
+    {
+        printString(writer, value);
+    }
+
+    static bool isEmpty(StringRef value) { return value.empty(); }
+};
+
+
+/******************************************************************************/
+/* SMART POINTERS                                                             */
+/******************************************************************************/
+
+// Mirrors the emplace hooks of the pointer reflection.
+template<typename T>
+T& staticEmplace(Reader& reader, std::shared_ptr<T>& ptr)
+{
+    if (Arena* arena = reader.arena())
+        ptr = std::allocate_shared<T>(ArenaAllocator<T>(*arena));
+    else ptr = std::make_shared<T>();
+    return *ptr;
+}
+
+template<typename T>
+T& staticEmplace(Reader&, std::unique_ptr<T>& ptr)
+{
+    ptr.reset(new T);
+    return *ptr;
+}
+
+template<typename Ptr, typename T>
+struct StaticPointerCodec
+{
+    static void parse(Reader& reader, Ptr& ptr)
+    {
+        if (reader.peekToken().type() == Token::Null) {
+            reader.nextToken();
+            ptr.reset();
+            return;
+        }
+
+        if (ptr) staticParse(reader, *ptr);
+        else staticParse(reader, staticEmplace(reader, ptr));
+    }
+
+    static void print(Writer& writer, const Ptr& ptr)
+    {
+        if (ptr) staticPrint(writer, *ptr);
+        else printNull(writer);
+    }
+
+    static bool isEmpty(const Ptr& ptr)
+    {
+        return !ptr || staticIsEmpty(*ptr);
+    }
+};
+
+template<typename T>
+struct StaticCodec< std::shared_ptr<T> > :
+        public StaticPointerCodec<std::shared_ptr<T>, T>
+{};
+
+template<typename T>
+struct StaticCodec< std::unique_ptr<T> > :
+        public StaticPointerCodec<std::unique_ptr<T>, T>
+{};
+
+
+/******************************************************************************/
+/* CONTAINERS                                                                 */
+/******************************************************************************/
+
+// Large top-level vectors are resized up front and their elements are parsed
+// in place by several threads.
+template<typename T, typename Alloc>
+bool parseInPlace(Reader& reader, std::vector<T, Alloc>& vector)
+{
+    if (!parallelCandidate(reader)) return false;
+
+    size_t size = reader.reuse() ? 0 : vector.size();
+
+    auto resize = [&] (size_t n) { vector.resize(size + n); };
+    auto onItem = [&] (Reader& reader, size_t i) {
+        staticParse(reader, vector[size + i]);
+    };
+
+    return parseParallel(reader, resize, onItem);
+}
+
+template<typename Alloc>
+bool parseInPlace(Reader&, std::vector<bool, Alloc>&) { return false; }
+
+template<typename T, typename Alloc>
+struct StaticCodec< std::vector<T, Alloc> >
+{
+    typedef std::vector<T, Alloc> Vector;
+
+    static void parse(Reader& reader, Vector& vector)
+    {
+        if (parseInPlace(reader, vector)) return;
+
+        if (reader.reuse()) {
+            parseReuse(reader, vector);
+            return;
+        }
+
+        // Keeps the growth geometric for callers that keep appending to the
+        // same vector.
+        static CapacityHint hint;
+        size_t size = vector.size();
+        if (vector.capacity() < size + hint.get())
+            vector.reserve(std::max(size + hint.get(), 2 * vector.capacity()));
+
+        auto onItem = [&] (size_t) {
+            vector.emplace_back();
+            staticParse(reader, vector.back());
+            if (!reader) vector.pop_back();
+        };
+        parseArray(reader, onItem);
+
+        hint.update(vector.size() - size);
+    }
+
+    static void print(Writer& writer, const Vector& vector)
+    {
+        auto printFn = [&] (size_t i) { staticPrint(writer, vector[i]); };
+        printArray(writer, vector.size(), printFn);
+    }
+
+    static bool isEmpty(const Vector& vector) { return vector.empty(); }
+
+private:
+
+    static void parseReuse(Reader& reader, Vector& vector)
+    {
+        size_t n = 0;
+        auto onItem = [&] (size_t i) {
+            bool append = i == vector.size();
+            if (append) vector.emplace_back();
+
+            staticParse(reader, vector[i]);
+            if (!reader && append) vector.pop_back();
+            n++;
+        };
+        parseArray(reader, onItem);
+
+        if (reader && n < vector.size())
+            vector.erase(vector.begin() + n, vector.end());
+    }
+};
+
+template<typename T, typename Compare, typename Alloc>
+struct StaticCodec< std::map<std::string, T, Compare, Alloc> >
+{
+    typedef std::map<std::string, T, Compare, Alloc> Map;
+
+    static void parse(Reader& reader, Map& map)
+    {
+        if (reader.reuse()) {
+            parseReuse(reader, map);
+            return;
+        }
+
+        // Only new keys are parsed in place so that a failure leaves existing
+        // values as they were.
+        auto onField = [&] (StringRef key) {
+            std::string name = key.str();
+            auto it = map.lower_bound(name);
+
+            if (it == map.end() || map.key_comp()(name, it->first)) {
+                it = map.emplace_hint(it, std::move(name), T());
+                staticParse(reader, it->second);
+                if (!reader) map.erase(it);
+            }
+            else {
+                T value{};
+                staticParse(reader, value);
+                if (reader) it->second = std::move(value);
+            }
+        };
+        parseObject(reader, onField);
+    }
+
+    static void print(Writer& writer, const Map& map)
+    {
+        std::vector<std::string> keys;
+        keys.reserve(map.size());
+        for (const auto& entry : map) keys.push_back(entry.first);
+
+        auto printFn = [&] (const std::string& key) {
+            staticPrint(writer, map.find(key)->second);
+        };
+        printObject(writer, keys, printFn);
+    }
+
+    static bool isEmpty(const Map& map) { return map.empty(); }
+
+private:
+
+    // Mirrors MapParser::parseReuse.
+    static void parseReuse(Reader& reader, Map& map)
+    {
+        size_t mark = reader.keyMark();
+
+        size_t n = 0;
+        auto onField = [&] (StringRef key) {
+            staticParse(reader, map[reader.pushKey(key)]);
+            if (reader) n++;
+        };
+        parseObject(reader, onField);
+
+        if (reader && map.size() > n) {
+            reader.sortKeys(mark);
+
+            for (auto it = map.begin(); it != map.end();) {
+                if (reader.hasKey(mark, it->first)) ++it;
+                else it = map.erase(it);
+            }
+        }
+
+        reader.popKeys(mark);
+    }
+};
+
+
+/******************************************************************************/
+/* OBJECTS                                                                    */
+/******************************************************************************/
+
+// Returns false if the type has a custom codec or fields that are not part of
+// its static description.
+bool staticObject(const Type* type, size_t fields);
+
+// Returns false if the field should be skipped.
+bool staticField(const Type* type, const std::string& name,
+        std::string& alias, bool& skipEmpty);
+
+template<typename T>
+struct StaticObject
+{
+    struct Entry
+    {
+        std::string alias;
+        bool skipEmpty;
+
+        void (*parse)(Reader&, T&);
+        void (*print)(Writer&, const T&);
+        bool (*isEmpty)(const T&);
+
+        // Allows the entries to be handed directly to printObject.
+        operator const std::string& () const { return alias; }
+        bool operator< (const Entry& other) const { return alias < other.alias; }
+    };
+
+    bool dynamic;
+    std::vector<Entry> entries;
+
+    static const StaticObject& get()
+    {
+        static StaticObject object;
+        return object;
+    }
+
+    const Entry* find(StringRef key) const
+    {
+        auto it = std::lower_bound(entries.begin(), entries.end(), key,
+                [] (const Entry& entry, StringRef key) {
+                    return StringRef(entry.alias) < key;
+                });
+
+        return it != entries.end() && key == it->alias ? &*it : nullptr;
+    }
+
+private:
+
+    template<typename Field>
+    struct FieldCodec
+    {
+        typedef typename std::remove_const<typename Field::type>::type F;
+
+        static void parse(Reader& reader, T& obj)
+        {
+            parseField(reader, obj, std::is_const<typename Field::type>());
+        }
+
+        static void parseField(Reader& reader, T& obj, std::false_type)
+        {
+            staticParse(reader, Field::get(obj));
+        }
+
+        static void parseField(Reader& reader, T&, std::true_type)
+        {
+            reader.error("unable to parse const field <%s>", Field::name());
+        }
+
+        static void print(Writer& writer, const T& obj)
+        {
+            staticPrint(writer, Field::get(obj));
+        }
+
+        static bool isEmpty(const T& obj)
+        {
+            return staticIsEmpty(Field::get(obj));
+        }
+    };
+
+    struct AddEntry
+    {
+        const Type* type;
+        std::vector<Entry>& entries;
+        size_t count;
+
+        template<typename Field>
+        void operator() (Field)
+        {
+            count++;
+
+            Entry entry;
+            if (!staticField(type, Field::name(), entry.alias, entry.skipEmpty))
+                return;
+
+            entry.parse = &FieldCodec<Field>::parse;
+            entry.print = &FieldCodec<Field>::print;
+            entry.isEmpty = &FieldCodec<Field>::isEmpty;
+            entries.push_back(std::move(entry));
+        }
+    };
+
+    StaticObject()
+    {
+        const Type* type = reflect::type<T>();
+
+        size_t count = forEachField<T>(AddEntry{ type, entries, 0 }).count;
+        dynamic = !staticObject(type, count);
+
+        std::sort(entries.begin(), entries.end());
+        for (size_t i = 1; i < entries.size(); ++i) {
+            if (entries[i - 1].alias != entries[i].alias) continue;
+            reflectError("duplicate json key <%s> in <%s>",
+                    entries[i].alias, type->id());
+        }
+    }
+};
+
+template<typename T>
+struct StaticCodec<T, typename std::enable_if<StaticFields<T>::reflected>::type>
+{
+    typedef StaticObject<T> Object;
+    typedef typename Object::Entry Entry;
+
+    static void parse(Reader& reader, T& obj)
+    {
+        const Object& object = Object::get();
+        if (object.dynamic) {
+            DynamicCodec<T>::parse(reader, obj);
+            return;
+        }
+
+        auto onField = [&] (StringRef key) {
+            const Entry* entry = object.find(key);
+            if (entry) entry->parse(reader, obj);
+            else skip(reader);
+        };
+        parseObject(reader, onField);
+    }
+
+    static void print(Writer& writer, const T& obj)
+    {
+        const Object& object = Object::get();
+        if (object.dynamic) {
+            DynamicCodec<T>::print(writer, obj);
+            return;
+        }
+
+        auto skipFn = [&] (const Entry& entry) {
+            if (!writer.compact() && !entry.skipEmpty) return false;
+            return entry.isEmpty(obj);
+        };
+
+        auto printFn = [&] (const Entry& entry) { entry.print(writer, obj); };
+
+        printObject(writer, object.entries, printFn, skipFn);
+    }
+
+    static bool isEmpty(const T&) { return false; }
+};
+
+} // namespace details
+} // namespace json
+} // namespace reflect
@@ -0,0 +1,19 @@
+/* string_ref.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include "json.h"
+
+reflectTypeImpl(reflect::json::StringRef)
+{
+    reflectPlumbing();
+    reflectAlloc();
+
+    reflectTypeTrait(string);
+
+    reflectFn(size);
+    reflectFn(empty);
+    reflectFn(str);
+    reflectCustom(operator std::string()) (const T_& value) { return value.str(); };
+}
@@ -0,0 +1,97 @@
+/* string_ref.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Non-owning view of a string.
+
+   String tokens borrow their bytes directly from the input whenever possible
+   so a StringRef is only valid until the reader moves past the next string
+   token. It should be converted into an std::string wherever it needs to be
+   kept around.
+
+   StringRef is also a reflected string type that can be used as a field to
+   avoid copying strings out of an input that outlives the parsed object.
+   Parsing into it borrows the string from the input when it needs no
+   unescaping and copies it into the reader's arena otherwise (see
+   Reader::keep). Without an arena, the parse fails on strings that can't be
+   borrowed so StringRef fields should be filled through the Arena& overloads
+   of parse or a reader whose arena was set by the caller.
+*/
+
+#include "reflect.h"
+#pragma once
+
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <ostream>
+#include <algorithm>
+
+namespace reflect {
+namespace json {
+
+/******************************************************************************/
+/* STRING REF                                                                 */
+/******************************************************************************/
+
+struct StringRef
+{
+    StringRef() : data_(nullptr), size_(0) {}
+    StringRef(const char* data, size_t size) : data_(data), size_(size) {}
+    StringRef(const char* str) : data_(str), size_(std::strlen(str)) {}
+    StringRef(const std::string& str) : data_(str.data()), size_(str.size()) {}
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return !size_; }
+    char operator[](size_t i) const { return data_[i]; }
+
+    const char* begin() const { return data_; }
+    const char* end() const { return data_ + size_; }
+
+    std::string str() const { return std::string(data_, size_); }
+    operator std::string() const { return str(); }
+
+    bool operator==(StringRef other) const
+    {
+        return size_ == other.size_ && !std::memcmp(data_, other.data_, size_);
+    }
+
+    bool operator!=(StringRef other) const { return !(*this == other); }
+
+    bool operator<(StringRef other) const
+    {
+        int cmp = std::memcmp(data_, other.data_, std::min(size_, other.size_));
+        return cmp ? cmp < 0 : size_ < other.size_;
+    }
+
+    // FNV-1a which is plenty good enough for json keys.
+    size_t hash() const
+    {
+        uint64_t hash = 0xcbf29ce484222325;
+        for (size_t i = 0; i < size_; ++i) {
+            hash ^= uint8_t(data_[i]);
+            hash *= 0x100000001b3;
+        }
+        return hash;
+    }
+
+    struct Hash
+    {
+        size_t operator() (StringRef ref) const { return ref.hash(); }
+    };
+
+private:
+    const char* data_;
+    size_t size_;
+};
+
+inline std::ostream& operator<<(std::ostream& stream, StringRef ref)
+{
+    return stream.write(ref.data(), ref.size());
+}
+
+} // namespace json
+} // namespace reflect
+
+reflectTypeDecl(reflect::json::StringRef)
@@ -10,21 +10,6 @@ namespace json {
 /* TOKEN                                                                      */
 /******************************************************************************/
 
-Token::
-Token(Type type, const std::string& value) :
-    type_(type), value_(&value)
-{}
-
-namespace  {
-std::string trueValue = "true";
-std::string falseValue = "false";
-}
-
-Token::
-Token(Type type, bool value) :
-    type_(type), value_(value ? &trueValue : &falseValue)
-{}
-
 bool
 Token::
 asBool() const
@@ -32,7 +17,7 @@ asBool() const
     if (type_ != Bool)
         reflectError("invalid conversion of token %s to <bool>", print());
 
-    return value_ == &trueValue;
+    return bool_;
 }
 
 int64_t
@@ -42,27 +27,35 @@ asInt() const
     if (type_ != Int)
         reflectError("invalid conversion of token %s to <int>", print());
 
-    return std::stol(*value_);
+    return int_;
 }
 
 double
 Token::
 asFloat() const
 {
-    if (type_ != Float)
+    // Integers are valid floats; parseFloat relies on this.
+    if (type_ != Float && type_ != Int)
         reflectError("invalid conversion of token %s to <float>", print());
 
-    return std::stod(*value_);
+    return type_ == Int ? double(int_) : float_;
 }
 
-const std::string&
+std::string
 Token::
 asString() const
+{
+    return asStringRef().str();
+}
+
+StringRef
+Token::
+asStringRef() const
 {
     if (type_ != String)
         reflectError("invalid conversion of token %s to <string>", print());
 
-    return *value_;
+    return string_;
 }
 
 std::string print(Token::Type type)
@@ -99,13 +92,209 @@ print() const
     std::stringstream ss;
 
     ss << "<Token " << reflect::json::print(type_);
-    if (value_) ss << ": " << *value_;
+    if (type_ == Int) ss << ": " << int_;
+    else if (type_ == Float) ss << ": " << std::setprecision(17) << float_;
+    else if (type_ == Bool) ss << ": " << (bool_ ? "true" : "false");
+    else if (type_ == String) ss << ": " << string_;
     ss << ">";
 
     return ss.str();
 }
 
 
+/******************************************************************************/
+/* NUMBER                                                                     */
+/******************************************************************************/
+
+namespace {
+
+bool isDigit(char c) { return unsigned(c - '0') < 10; }
+
+uint64_t loadEight(const char* it)
+{
+    uint64_t value;
+    std::memcpy(&value, it, sizeof(value));
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+
+    return value;
+}
+
+// SWAR check that all 8 bytes are ascii digits: adding 0x46 carries into the
+// high bit of any byte above '9' and subtracting 0x30 borrows into the high bit
+// of any byte below '0'.
+bool isEightDigits(uint64_t value)
+{
+    return !(((value + 0x4646464646464646) | (value - 0x3030303030303030)) &
+            0x8080808080808080);
+}
+
+// Converts 8 ascii digits into their value with 3 multiplications by
+// combining pairs of digits, then pairs of pairs and so on.
+uint64_t parseEightDigits(uint64_t value)
+{
+    const uint64_t mask = 0x000000FF000000FF;
+    const uint64_t mul1 = 100 + (1000000ULL << 32);
+    const uint64_t mul2 = 1 + (10000ULL << 32);
+
+    value -= 0x3030303030303030;
+    value = (value * 10) + (value >> 8);
+    return (((value & mask) * mul1) + (((value >> 16) & mask) * mul2)) >> 32;
+}
+
+struct Number
+{
+    bool negative;
+    bool isFloat;
+
+    // Number of digits in the integral and fractional part. Zero means that
+    // the number is invalid.
+    size_t digits;
+
+    // Every digit accumulated regardless of overflow which is detected by
+    // counting the significant digits.
+    uint64_t mantissa;
+    size_t significant;
+    int64_t exponent;
+};
+
+// Accumulates digits into the mantissa 8 at a time when possible.
+const char* readDigits(const char* it, const char* end, uint64_t& mantissa)
+{
+    while (end - it >= 8) {
+        uint64_t value = loadEight(it);
+        if (!isEightDigits(value)) break;
+
+        mantissa = mantissa * 100000000 + parseEightDigits(value);
+        it += 8;
+    }
+
+    for (; it != end && isDigit(*it); ++it)
+        mantissa = mantissa * 10 + (*it - '0');
+
+    return it;
+}
+
+// Decodes the number starting at it which follows the grammar:
+//
+//     -? [0-9]* (\. [0-9]*)? ([eE] [+-]? [0-9]*)?
+//
+// Returns the end of the number which is equal to end if the number may
+// continue past the end of the range in which case the result should be
+// discarded.
+const char* scanNumber(const char* it, const char* end, Number& number)
+{
+    number = Number();
+
+    if (*it == '-') { number.negative = true; ++it; }
+
+    const char* digits = it;
+    it = readDigits(it, end, number.mantissa);
+    size_t integral = it - digits;
+    size_t fraction = 0;
+
+    if (it != end && *it == '.') {
+        number.isFloat = true;
+
+        const char* start = ++it;
+        it = readDigits(it, end, number.mantissa);
+        fraction = it - start;
+    }
+
+    number.digits = integral + fraction;
+    number.exponent = -int64_t(fraction);
+
+    // Leading zeros don't count towards the overflow of the mantissa.
+    number.significant = number.digits;
+    if (number.significant > 19) {
+        for (; number.significant && (*digits == '0' || *digits == '.'); ++digits)
+            if (*digits == '0') number.significant--;
+    }
+
+    if (it == end || (*it != 'e' && *it != 'E')) return it;
+    number.isFloat = true;
+    ++it;
+
+    bool negative = false;
+    if (it != end && (*it == '+' || *it == '-')) negative = *it++ == '-';
+
+    const char* start = it;
+    int64_t exponent = 0;
+    for (; it != end && isDigit(*it); ++it) {
+        // Anything this large is either zero or infinite; we just need to not
+        // overflow.
+        if (exponent < 100000) exponent = exponent * 10 + (*it - '0');
+    }
+
+    if (it == start) number.digits = 0;
+    number.exponent += negative ? -exponent : exponent;
+
+    return it;
+}
+
+bool decodeInt(const Number& number, int64_t& value)
+{
+    const uint64_t max = uint64_t(INT64_MAX) + number.negative;
+    if (number.significant > 19 || number.mantissa > max) return false;
+
+    value = number.negative ? -int64_t(number.mantissa - 1) - 1 : number.mantissa;
+    return true;
+}
+
+// Clinger's fast path: a mantissa and a power of ten that are both exactly
+// representable as doubles yield a correctly rounded result with a single
+// floating point operation. Everything else goes through strtod.
+double decodeFloat(const Number& number, const char* first, const char* last)
+{
+    static const double powers[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const uint64_t maxMantissa = 1ULL << 53;
+
+    if (number.significant <= 19) {
+        uint64_t mantissa = number.mantissa;
+        int64_t exponent = number.exponent;
+
+        // Moves the excess of a large exponent into the mantissa if the
+        // result is still exact: 12e30 is 12000000000e22.
+        while (exponent > 22 && mantissa && mantissa < maxMantissa / 10) {
+            mantissa *= 10;
+            exponent--;
+        }
+
+        if (!mantissa) return number.negative ? -0.0 : 0.0;
+
+        if (mantissa <= maxMantissa && exponent >= -22 && exponent <= 22) {
+            double value = double(mantissa);
+            if (exponent < 0) value /= powers[-exponent];
+            else value *= powers[exponent];
+            return number.negative ? -value : value;
+        }
+    }
+
+    char buffer[64];
+    std::string copy;
+    const char* str = buffer;
+
+    size_t size = last - first;
+    if (size < sizeof(buffer)) {
+        std::memcpy(buffer, first, size);
+        buffer[size] = '\0';
+    }
+    else {
+        copy.assign(first, last);
+        str = copy.c_str();
+    }
+
+    return std::strtod(str, nullptr);
+}
+
+} // namespace anonymous
+
+
 /******************************************************************************/
 /* TOKENIZER                                                                  */
 /******************************************************************************/
@@ -115,10 +304,16 @@ namespace {
 char nextChar(Reader& reader)
 {
     while (reader) {
-        char c = reader.pop();
+        const char* end = reader.end();
+        const char* it = details::skipSpace(reader.cursor(), end);
+        reader.advance(it);
+
+        if (it == end) {
+            if (reader.refill()) continue;
+            return reader.pop();
+        }
 
-        if (c == '\n') reader.newline();
-        if (std::isspace(c)) continue;
+        char c = reader.pop();
 
         if (c == '/' && reader.peek() == '/') {
             if (!reader.allowComments())
@@ -214,12 +409,18 @@ void readUnicode(Reader& reader)
     if (reader && i != 4) reader.error("\\u requires 4 hex digits", i);
 }
 
+// Only used for the sequences that the bulk validation of the string couldn't
+// vouch for, usually because they straddle two blocks of a stream, and must
+// agree with details::validateUtf8.
 void validateUnicode(Reader& reader, char c)
 {
     reader.save(c);
 
     size_t bytes = clz(~c);
-    if (bytes > 4 || bytes < 2) reader.error("invalid UTF-8 header: %x", c);
+    if (bytes > 4 || bytes < 2) {
+        reader.error("invalid UTF-8 header: %x", c);
+        return;
+    }
 
     uint32_t mask = (1 << (7 - bytes)) - 1;
     uint32_t code = uint32_t(c) & mask;
@@ -230,20 +431,62 @@ void validateUnicode(Reader& reader, char c)
         code = (code << 6) | (c & 0x3F);
     }
 
-    switch (bytes) {
-    case 4: if (code > 0xFFFF) return; break;
-    case 3: if (code > 0x7FF) return; break;
-    case 2: if (code > 0x7F) return; break;
-    }
+    static const uint32_t min[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (code < min[bytes] || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF))
+        reader.error("invalid UTF-8 encoding");
+}
 
-    reader.error("invalid UTF-8 encoding");
+// Returns the end of the run of characters that can be copied as is. Pure
+// ASCII is only scanned once and the rest of the run is validated in bulk once
+// a non-ASCII byte shows up.
+const char* scanPlain(const char* it, const char* end, bool validate)
+{
+    it = details::scanString(it, end, validate);
+    if (it == end || !(*it & 0x80)) return it;
+
+    return details::validateUtf8(it, details::scanString(it, end, false));
 }
 
-void readString(Reader& reader)
+// Strings without escapes are borrowed straight from the input when it's
+// contiguous. Otherwise, runs of plain characters are copied into the reader's
+// buffer and only escapes, control characters and the sequences that fail the
+// bulk unicode validation are handled a character at a time.
+StringRef readString(Reader& reader)
 {
+    const bool validate = reader.validateUnicode();
+
+    const char* start = reader.cursor();
+    const char* end = reader.end();
+    const char* it = start;
+
+    if (reader.contiguous()) {
+        it = scanPlain(start, end, validate);
+
+        if (it != end && *it == '"') {
+            reader.advance(it + 1);
+            return StringRef(start, it - start);
+        }
+    }
+
+    // Escapes and invalid unicode are handled by the slow path.
     reader.resetBuffer();
+    reader.save(start, it);
+    reader.advance(it);
 
     while (reader) {
+        const char* start = reader.cursor();
+        const char* end = reader.end();
+        const char* it = scanPlain(start, end, validate);
+
+        reader.save(start, it);
+        reader.advance(it);
+
+        if (it == end) {
+            if (reader.refill()) continue;
+            reader.pop();
+            break;
+        }
+
         char c = reader.pop();
 
         if (c == '\n') {
@@ -251,54 +494,53 @@ void readString(Reader& reader)
             continue;
         }
 
-        if ((c & 0x80) && reader.validateUnicode()) {
+        if (c & 0x80) {
             validateUnicode(reader, c);
             continue;
         }
 
-        if (c == '"') return;
-        if (c == '\\') {
-            switch(c = reader.pop()) {
-            case '"':
-            case '/':
-            case '\\': break;
-
-            case 'b': c = '\b'; break;
-            case 'f': c = '\f'; break;
-            case 'n': c = '\n'; break;
-            case 'r': c = '\r'; break;
-            case 't': c = '\t'; break;
-            case 'u': readUnicode(reader); continue;
-            default:
-                reader.error("unknown escaped character <%c>", c);
-                return;
-            }
+        if (c == '"') return reader.buffer();
+        if (c != '\\') {
+            reader.save(c);
+            continue;
+        }
+
+        switch(c = reader.pop()) {
+        case '"':
+        case '/':
+        case '\\': break;
+
+        case 'b': c = '\b'; break;
+        case 'f': c = '\f'; break;
+        case 'n': c = '\n'; break;
+        case 'r': c = '\r'; break;
+        case 't': c = '\t'; break;
+        case 'u': readUnicode(reader); continue;
+        default:
+            reader.error("unknown escaped character <%c>", c);
+            return reader.buffer();
         }
 
         reader.save(c);
     };
 
     reader.error("unexpected end of string");
+    return reader.buffer();
 }
 
-Token::Type readNumber(Reader& reader, char c)
+// Gathers the number a character at a time for the rare case where it
+// straddles two blocks of a stream. The buffer is then decoded like any other
+// range.
+void gatherNumber(Reader& reader, char c)
 {
-    Token::Type type = Token::Int;
     reader.resetBuffer();
     reader.save(c); // can be either - or [0-9].
 
     auto readDigits = [&] {
-        while (reader && std::isdigit(c = reader.peek()))
+        while (reader && isDigit(reader.peek()))
             reader.save(reader.pop());
     };
 
-    auto readChar = [&] (char c) {
-        if (!reader || reader.peek() != c) return false;
-
-        reader.save(reader.pop());
-        return true;
-    };
-
     auto readChars = [&] (char a, char b) {
         if (!reader || (reader.peek() != a && reader.peek() != b))
             return false;
@@ -308,18 +550,50 @@ Token::Type readNumber(Reader& reader, char c)
     };
 
     readDigits();
-    if (readChar('.')) {
-        type = Token::Float;
-        readDigits();
-    }
+    if (readChars('.', '.')) readDigits();
 
     if (readChars('e', 'E')) {
-        type = Token::Float;
         readChars('+', '-');
         readDigits();
     }
+}
+
+Token readNumber(Reader& reader, char c)
+{
+    // c was just popped so it's still sitting in the reader's buffer.
+    const char* first = reader.cursor() - 1;
+    const char* end = reader.end();
+
+    Number number;
+    const char* last = scanNumber(first, end, number);
+
+    if (last == end) {
+        gatherNumber(reader, c);
+
+        const std::string& buffer = reader.buffer();
+        first = buffer.data();
+        last = scanNumber(first, first + buffer.size(), number);
+    }
+    else reader.advance(last);
+
+    if (!number.digits) {
+        reader.error("invalid number <%s>", std::string(first, last));
+        return Token(Token::EOS);
+    }
 
-    return type;
+    if (!number.isFloat) {
+        int64_t value;
+        if (decodeInt(number, value)) return Token(Token::Int, value);
+
+        reader.error("integer overflow <%s>", std::string(first, last));
+        return Token(Token::EOS);
+    }
+
+    double value = decodeFloat(number, first, last);
+    if (!std::isinf(value)) return Token(Token::Float, value);
+
+    reader.error("float overflow <%s>", std::string(first, last));
+    return Token(Token::EOS);
 }
 
 } // namespace anonymous
@@ -349,8 +623,7 @@ Token nextToken(Reader& reader)
     case 'f': readLiteral(reader, "alse"); return Token(Token::Bool, false);
 
     case '"':
-        readString(reader);
-        return Token(Token::String, reader.buffer());
+        return Token(Token::String, readString(reader));
 
     case '-':
     case '0':
@@ -363,16 +636,107 @@ Token nextToken(Reader& reader)
     case '7':
     case '8':
     case '9':
-    {
-        Token::Type type = readNumber(reader, c);
-        return Token(type, reader.buffer());
-    }
+        return readNumber(reader, c);
+
     default:
         reader.error("unexpected character <%c>", c);
         return Token(Token::EOS);
     }
 }
 
+} // namespace details
+
+
+/******************************************************************************/
+/* SKIP                                                                       */
+/******************************************************************************/
+
+namespace {
+
+void skipString(Reader& reader)
+{
+    bool escaped = false;
+
+    while (reader) {
+        const char* it = reader.cursor();
+        const char* end = reader.end();
+
+        if (it == end) {
+            if (!reader.refill()) reader.pop();
+            continue;
+        }
+
+        if (escaped) {
+            escaped = false;
+            reader.advance(it + 1);
+            continue;
+        }
+
+        it = details::scanString(it, end, false);
+        if (it == end) {
+            reader.advance(it);
+            continue;
+        }
+
+        reader.advance(it + 1);
+        if (*it == '"') return;
+        if (*it == '\\') escaped = true;
+    }
+}
+
+void skipContainer(Reader& reader)
+{
+    details::SkipState state(1);
+
+    while (reader) {
+        const char* it = details::skipNested(reader.cursor(), reader.end(), state);
+        reader.advance(it);
+
+        if (!state.depth) return;
+        if (!reader.refill()) reader.pop();
+    }
+}
+
+} // namespace anonymous
+
+namespace details {
+
+void skipRaw(Reader& reader)
+{
+    char c = nextChar(reader);
+    if (!reader) return;
+
+    switch(c)
+    {
+    case '{':
+    case '[': skipContainer(reader); break;
+
+    case '"': skipString(reader); break;
+
+    case 'n': readLiteral(reader, "ull"); break;
+    case 't': readLiteral(reader, "rue"); break;
+    case 'f': readLiteral(reader, "alse"); break;
+
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        readNumber(reader, c);
+        break;
+
+    default:
+        reader.error("unexpected character <%c>", c);
+        break;
+    }
+}
+
 } // namespace details
 } // namespace json
 } // reflect
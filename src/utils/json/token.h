@@ -27,23 +27,37 @@ struct Token
         EOS
     };
 
-    Token() : type_(NoToken), value_(nullptr) {}
-    Token(Type type) : type_(type), value_(nullptr) {}
-    Token(Type type, bool value);
-    Token(Type type, const std::string& value);
+    Token() : type_(NoToken), int_(0) {}
+    Token(Type type) : type_(type), int_(0) {}
+    Token(Type type, bool value) : type_(type), bool_(value) {}
+    Token(Type type, int64_t value) : type_(type), int_(value) {}
+    Token(Type type, double value) : type_(type), float_(value) {}
+    Token(Type type, StringRef value) : type_(type), string_(value) {}
 
     Type type() const { return type_; }
 
     bool asBool() const;
     int64_t asInt() const;
     double asFloat() const;
-    const std::string& asString() const;
+    std::string asString() const;
+
+    // Only valid until the reader moves past the next string token.
+    StringRef asStringRef() const;
 
     std::string print() const;
 
 private:
     Type type_;
-    const std::string* value_;
+
+    // Numbers are decoded by the tokenizer while strings reference either
+    // the input or the reader's buffer.
+    union
+    {
+        bool bool_;
+        int64_t int_;
+        double float_;
+        StringRef string_;
+    };
 };
 
 std::string print(Token::Type type);
@@ -53,6 +67,11 @@ namespace details {
 
 Token nextToken(Reader& reader);
 
+// Skips the next value without decoding it. Containers and strings are only
+// scanned for their boundaries which means that their content isn't
+// validated. Comments are not supported.
+void skipRaw(Reader& reader);
+
 } // namespace details
 } // namespace json
 } // namespace reflect
@@ -0,0 +1,394 @@
+/* validate.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+namespace reflect {
+namespace json {
+namespace {
+
+/******************************************************************************/
+/* VALIDATE TOKENS                                                            */
+/******************************************************************************/
+
+// Consumes the key of an object field up to its separator.
+bool validateKey(Reader& reader, const Token& token)
+{
+    if (!reader.assertToken(token, Token::String)) return false;
+    reader.expectToken(Token::KeySeparator);
+    return reader;
+}
+
+void validateTokens(Reader& reader)
+{
+    // Open containers from the outermost; true for objects.
+    std::vector<bool> stack;
+
+    Token token = reader.nextToken();
+
+    while (reader) {
+
+        // token is the first token of a value.
+        switch (token.type()) {
+
+        case Token::Null:
+        case Token::Bool:
+        case Token::Int:
+        case Token::Float:
+        case Token::String:
+            break;
+
+        case Token::ArrayStart:
+            token = reader.nextToken();
+            if (token.type() == Token::ArrayEnd) break;
+
+            stack.push_back(false);
+            continue;
+
+        case Token::ObjectStart:
+            token = reader.nextToken();
+            if (token.type() == Token::ObjectEnd) break;
+
+            if (!validateKey(reader, token)) return;
+            stack.push_back(true);
+            token = reader.nextToken();
+            continue;
+
+        default:
+            reader.error("unexpected token <%s>", token.print());
+            return;
+        }
+
+        // The value is complete so we close every container that ends with it
+        // and move on to the next value of the innermost one left.
+        while (reader && !stack.empty()) {
+            token = reader.nextToken();
+
+            bool object = stack.back();
+            if (token.type() == (object ? Token::ObjectEnd : Token::ArrayEnd)) {
+                stack.pop_back();
+                continue;
+            }
+
+            if (!reader.assertToken(token, Token::Separator)) return;
+            if (object && !validateKey(reader, reader.nextToken())) return;
+
+            token = reader.nextToken();
+            break;
+        }
+
+        if (!stack.empty()) continue;
+
+        token = reader.nextToken();
+        if (reader) reader.error("unexpected token <%s> after value", token.print());
+        return;
+    }
+
+    // The end of the input within a value.
+    if (!reader.error()) reader.error("unexpected end of input");
+}
+
+
+
+/******************************************************************************/
+/* VALIDATE STRUCTURALS                                                       */
+/******************************************************************************/
+
+bool isHex(char c)
+{
+    return isDigit(c) || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f');
+}
+
+// Walks the structural characters of the index and checks the scalars in the
+// gaps between them. Gaps are only checked against the grammar so numbers
+// that overflow are still accepted.
+struct Structurals
+{
+    enum Kind
+    {
+        Invalid, End, Scalar, String,
+        ArrayStart, ArrayEnd, ObjectStart, ObjectEnd, Separator, KeySeparator
+    };
+
+    Structurals(Reader& reader, const std::vector<uint32_t>& index) :
+        reader(reader), index(index), i(0),
+        it(reader.begin()), start(reader.begin())
+    {}
+
+    Kind next()
+    {
+        const char* stop = i < index.size() ? reader.begin() + index[i] : reader.end();
+
+        start = details::skipSpace(it, stop);
+        if (start != stop) {
+            const char* end = stop;
+            while (end != start && isSpace(end[-1])) --end;
+
+            it = stop;
+            return scalar(end);
+        }
+
+        if (i == index.size()) return End;
+        it = stop + 1;
+        i++;
+
+        switch (*stop) {
+        case '[': return ArrayStart;
+        case ']': return ArrayEnd;
+        case '{': return ObjectStart;
+        case '}': return ObjectEnd;
+        case ',': return Separator;
+        default:  return KeySeparator;
+        }
+    }
+
+    // Reports the kind as unexpected at the start of the last token.
+    void unexpected(Kind kind)
+    {
+        if (kind == Invalid) return;
+
+        if (kind == End) fail(reader.end(), "unexpected end of input");
+        else fail(start, "unexpected character <%c>", *start);
+    }
+
+private:
+
+    static bool isSpace(char c)
+    {
+        return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+
+    template<typename... Args>
+    Kind fail(const char* pos, const char* fmt, Args&&... args)
+    {
+        reader.advance(pos);
+        reader.error(fmt, std::forward<Args>(args)...);
+        return Invalid;
+    }
+
+    Kind scalar(const char* end)
+    {
+        const char* pos = start;
+
+        switch (*pos) {
+        case '"': return string(end);
+        case 'n': return literal(end, "null");
+        case 't': return literal(end, "true");
+        case 'f': return literal(end, "false");
+        case '-': return number(end);
+        default:
+            if (isDigit(*pos)) return number(end);
+            return fail(pos, "unexpected character <%c>", *pos);
+        }
+    }
+
+    Kind literal(const char* end, const char* exp)
+    {
+        size_t n = std::strlen(exp);
+        if (size_t(end - start) != n || std::memcmp(start, exp, n))
+            return fail(start, "invalid literal, expected <%s>", exp);
+        return Scalar;
+    }
+
+    // Follows the grammar: -? (0 | [1-9] [0-9]*) (\. [0-9]+)? ([eE] [+-]? [0-9]+)?
+    Kind number(const char* end)
+    {
+        const char* pos = start;
+
+        auto digits = [&] {
+            const char* first = pos;
+            while (pos != end && isDigit(*pos)) ++pos;
+            return pos != first;
+        };
+
+        if (*pos == '-') ++pos;
+
+        if (pos != end && *pos == '0') ++pos;
+        else if (!digits()) return fail(pos, "invalid number");
+
+        if (pos != end && *pos == '.') {
+            ++pos;
+            if (!digits()) return fail(pos, "invalid number");
+        }
+
+        if (pos != end && (*pos == 'e' || *pos == 'E')) {
+            ++pos;
+            if (pos != end && (*pos == '+' || *pos == '-')) ++pos;
+            if (!digits()) return fail(pos, "invalid number");
+        }
+
+        if (pos != end) return fail(pos, "unexpected character <%c>", *pos);
+        return Scalar;
+    }
+
+    // UTF-8 was already checked in bulk if it needed to be so only escapes
+    // and the closing quote are left.
+    Kind string(const char* end)
+    {
+        const char* pos = start + 1;
+
+        while (true) {
+            pos = details::scanString(pos, end, false);
+            if (pos == end) return fail(end, "unexpected end of string");
+
+            char c = *pos++;
+            if (c == '"') break;
+
+            if (c == '\n') return fail(pos - 1, "invalid \\n character in a string");
+            if (c != '\\') continue;
+
+            if (pos == end) return fail(end, "unexpected end of string");
+            switch (c = *pos++) {
+            case '"': case '\\': case '/':
+            case 'b': case 'f': case 'n': case 'r': case 't':
+                break;
+
+            case 'u':
+                for (size_t j = 0; j < 4; ++j, ++pos) {
+                    if (pos == end || !isHex(*pos))
+                        return fail(pos, "invalid unicode escape");
+                }
+                break;
+
+            default:
+                return fail(pos - 1, "unknown escaped character <%c>", c);
+            }
+        }
+
+        if (pos != end) return fail(pos, "unexpected character <%c>", *pos);
+        return String;
+    }
+
+    Reader& reader;
+    const std::vector<uint32_t>& index;
+    size_t i;
+
+    const char* it;
+    const char* start; // Start of the last token.
+};
+
+// Same walk as validateTokens but over the structural index.
+void validateStructurals(Reader& reader)
+{
+    std::vector<uint32_t> index;
+    index.reserve((reader.end() - reader.begin()) / 8);
+    details::indexStructurals(reader.begin(), reader.end(), index);
+
+    Structurals cursor(reader, index);
+
+    auto validateKey = [&] (Structurals::Kind kind) {
+        if (kind != Structurals::String) {
+            cursor.unexpected(kind);
+            return false;
+        }
+
+        kind = cursor.next();
+        if (kind == Structurals::KeySeparator) return true;
+
+        cursor.unexpected(kind);
+        return false;
+    };
+
+    // Open containers from the outermost; true for objects.
+    std::vector<bool> stack;
+
+    Structurals::Kind kind = cursor.next();
+
+    while (true) {
+
+        // kind is the first token of a value.
+        switch (kind) {
+
+        case Structurals::Scalar:
+        case Structurals::String:
+            break;
+
+        case Structurals::ArrayStart:
+            kind = cursor.next();
+            if (kind == Structurals::ArrayEnd) break;
+
+            stack.push_back(false);
+            continue;
+
+        case Structurals::ObjectStart:
+            kind = cursor.next();
+            if (kind == Structurals::ObjectEnd) break;
+
+            if (!validateKey(kind)) return;
+            stack.push_back(true);
+            kind = cursor.next();
+            continue;
+
+        default:
+            cursor.unexpected(kind);
+            return;
+        }
+
+        // The value is complete so we close every container that ends with it
+        // and move on to the next value of the innermost one left.
+        while (!stack.empty()) {
+            kind = cursor.next();
+
+            bool object = stack.back();
+            if (kind == (object ? Structurals::ObjectEnd : Structurals::ArrayEnd)) {
+                stack.pop_back();
+                continue;
+            }
+
+            if (kind != Structurals::Separator) {
+                cursor.unexpected(kind);
+                return;
+            }
+            if (object && !validateKey(cursor.next())) return;
+
+            kind = cursor.next();
+            break;
+        }
+
+        if (!stack.empty()) continue;
+
+        kind = cursor.next();
+        if (kind != Structurals::End) cursor.unexpected(kind);
+        return;
+    }
+}
+
+} // namespace anonymous
+
+
+/******************************************************************************/
+/* VALIDATE                                                                   */
+/******************************************************************************/
+
+Error validate(const char* first, const char* last, Reader::Options options)
+{
+    // Strings don't need to be checked again once the entire input is known to
+    // be valid UTF-8.
+    Reader reader(first, last, Reader::Options(options & ~Reader::ValidateUnicode));
+
+    if (options & Reader::ValidateUnicode) {
+        const char* it = details::validateUtf8(first, last);
+        if (it != last) {
+            reader.advance(it);
+            reader.error("invalid UTF-8 encoding");
+            return reader.error();
+        }
+    }
+
+    // Comments can hide structural characters from the index.
+    bool indexable = !(options & Reader::AllowComments)
+        && size_t(last - first) <= std::numeric_limits<uint32_t>::max();
+
+    if (indexable) validateStructurals(reader);
+    else validateTokens(reader);
+
+    return reader.error();
+}
+
+Error validate(const std::string& str, Reader::Options options)
+{
+    return validate(str.data(), str.data() + str.size(), options);
+}
+
+} // namespace json
+} // namespace reflect
@@ -0,0 +1,38 @@
+/* validate.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Validation of json without parsing it into anything.
+
+   The UTF-8 of the entire input is checked in bulk by the scanning kernels,
+   which is valid since json outside of strings is pure ASCII. The syntax is
+   then checked from the structural index of the parallel parser: the
+   structural characters are walked with an explicit stack, so that
+   arbitrarily deep documents can't exhaust the call stack, and the gaps
+   between them are checked as literals, numbers or strings against the json
+   grammar only. Numbers are never decoded and strings never copied; the only
+   allocation is the index itself.
+
+   Inputs with comments and inputs larger than 4GB are walked by the
+   tokenizer instead.
+*/
+
+#include "json.h"
+#pragma once
+
+namespace reflect {
+namespace json {
+
+
+/******************************************************************************/
+/* VALIDATE                                                                   */
+/******************************************************************************/
+
+// Checks that the input holds exactly one json value, optionally surrounded by
+// whitespace. UTF-8 is only checked if ValidateUnicode is set and comments are
+// only accepted if AllowComments is set.
+Error validate(const char* first, const char* last, Reader::Options options = Reader::Default);
+Error validate(const std::string& str, Reader::Options options = Reader::Default);
+
+} // namespace json
+} // namespace reflect
@@ -12,6 +12,63 @@ namespace json {
 
 namespace { std::string spaces(4096ULL, ' '); }
 
+Writer::
+Writer(std::ostream& stream, Options options) :
+    stream(&stream), cur_(nullptr), end_(nullptr),
+    indent_(0), options(options)
+{
+    buffer_.resize(128);
+}
+
+Writer::
+Writer(Sink sink, Options options) :
+    stream(nullptr), sink(std::move(sink)), block(BlockSize),
+    cur_(block.data()), end_(block.data() + block.size()),
+    indent_(0), options(options)
+{
+    buffer_.resize(128);
+}
+
+void
+Writer::
+pushSlow(const char* c, size_t n)
+{
+    if (stream) {
+        stream->write(c, n);
+        return;
+    }
+
+    flush();
+
+    if (n < block.size()) {
+        std::memcpy(cur_, c, n);
+        cur_ += n;
+    }
+    else if (!sink(c, n)) error("unable to write output");
+}
+
+void
+Writer::
+flush()
+{
+    if (stream) return;
+
+    size_t n = cur_ - block.data();
+    if (!n) return;
+
+    cur_ = block.data();
+    if (!sink(block.data(), n)) error("unable to write output");
+}
+
+void
+Writer::
+reset()
+{
+    flush();
+    error_ = Error();
+    indent_ = 0;
+}
+
 void
 Writer::
 space()
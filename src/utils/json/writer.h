@@ -27,21 +27,49 @@ struct Writer
         Default = EscapeUnicode | ValidateUnicode,
     };
 
-    Writer(std::ostream& stream, Options options = Default) :
-        stream(stream), indent_(0), options(options)
-    {
-        buffer_.resize(128);
-    }
+    // Output is gathered in blocks of BlockSize bytes which are handed to the
+    // sink as they fill up and when the writer is flushed or destroyed. The
+    // sink returns false if it was unable to write the block.
+    enum { BlockSize = 1024 * 1024 };
+    typedef std::function<bool(const char* data, size_t size)> Sink;
+
+    // Writes straight through to the stream.
+    Writer(std::ostream& stream, Options options = Default);
+    Writer(Sink sink, Options options = Default);
+    ~Writer() { flush(); }
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
 
-    operator bool() const { return !error_ && stream; }
+    operator bool() const { return !error_ && (!stream || *stream); }
 
     template<typename... Args>
     void error(const char* fmt, Args&&... args);
     const Error& error() const { return error_; }
 
-    void push(char c) { stream.put(c); }
-    void push(const char* c, size_t n) { stream.write(c, n); }
-    void push(const std::string& c) { stream.write(c.c_str(), c.size()); }
+    void push(char c)
+    {
+        if (cur_ != end_) *cur_++ = c;
+        else pushSlow(&c, 1);
+    }
+
+    void push(const char* c, size_t n)
+    {
+        if (n < size_t(end_ - cur_)) {
+            std::memcpy(cur_, c, n);
+            cur_ += n;
+        }
+        else pushSlow(c, n);
+    }
+
+    void push(const std::string& c) { push(c.c_str(), c.size()); }
+
+    // Hands whatever is buffered to the sink.
+    void flush();
+
+    // Flushes and clears the error and indentation so that the writer and its
+    // buffers can be reused for the next document.
+    void reset();
 
     std::vector<char>& buffer() { return buffer_; }
 
@@ -56,7 +84,15 @@ struct Writer
     void space();
 
 private:
-    std::ostream& stream;
+    void pushSlow(const char* c, size_t n);
+
+    std::ostream* stream;
+
+    Sink sink;
+    std::vector<char> block;
+    char* cur_;
+    char* end_;
+
     std::vector<char> buffer_;
     Error error_;
 
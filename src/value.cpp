@@ -17,6 +17,12 @@ namespace reflect {
 Value::
 Value() : value_(nullptr) {}
 
+Value::
+Value(const Type* type, void* value, bool isConst) :
+    arg(type, RefType::LValue, isConst),
+    value_(value)
+{}
+
 // This is required to avoid trigerring the templated constructor for Value when
 // trying to copy non-const Values. This is common in data-structures like
 // vectors where entries would get infinitely wrapped in layers of Values
@@ -114,20 +120,387 @@ rvalue() const
     return result;
 }
 
+Value
+Value::
+fieldValue(const Field& field) const
+{
+    bool isConst = field.argument().isConst() || this->isConst();
+    return Value(
+            field.type(), static_cast<uint8_t*>(value_) + field.offset(), isConst);
+}
+
+Value
+Value::
+pointee() const
+{
+    const Type* type = this->type();
+    if (!type->isPointer()) reflectError("<%s> is not a pointer", type->id());
+
+    if (!type->hasPointerGetter() && type->pointerKind() != PointerKind::Raw) {
+        if (!((bool) *this)) return Value();
+        return *(*this);
+    }
+
+    void* pointee = type->pointerGet(value_);
+    if (!pointee) return Value();
+
+    // Matches the constness of the operator* of raw pointers.
+    bool isConst = type->pointerKind() == PointerKind::Raw && this->isConst();
+    return Value(type->pointee(), pointee, isConst);
+}
+
 bool
 Value::
 operator!() const
 {
-    if (type()->hasFunction("operator!"))
-        return call<bool>("operator!");
+    if (type()->isArithmetic()) return !((bool) *this);
+
+    if (type()->hasFunction(Operator::LogicNot))
+        return call<bool>(Operator::LogicNot);
     return !((bool) *this);
 }
 
+
+/******************************************************************************/
+/* ARITHMETIC                                                                 */
+/******************************************************************************/
+
+namespace {
+
+template<typename T>
+struct IsNumber :
+        public std::integral_constant<bool, !std::is_same<T, bool>::value>
+{};
+
+template<typename T>
+struct IsInteger :
+        public std::integral_constant<bool,
+            std::is_integral<T>::value && IsNumber<T>::value>
+{};
+
+
+template<template<typename> class Op, typename... Args>
+auto dispatch(TypeKind kind, Args&&... args)
+    -> decltype(Op<int>::call(std::forward<Args>(args)...))
+{
+    switch (kind)
+    {
+    case TypeKind::Bool:       return Op<bool>::call(std::forward<Args>(args)...);
+    case TypeKind::Char:       return Op<char>::call(std::forward<Args>(args)...);
+    case TypeKind::SChar:      return Op<signed char>::call(std::forward<Args>(args)...);
+    case TypeKind::UChar:      return Op<unsigned char>::call(std::forward<Args>(args)...);
+    case TypeKind::Short:      return Op<short int>::call(std::forward<Args>(args)...);
+    case TypeKind::UShort:     return Op<unsigned short int>::call(std::forward<Args>(args)...);
+    case TypeKind::Int:        return Op<int>::call(std::forward<Args>(args)...);
+    case TypeKind::UInt:       return Op<unsigned int>::call(std::forward<Args>(args)...);
+    case TypeKind::Long:       return Op<long int>::call(std::forward<Args>(args)...);
+    case TypeKind::ULong:      return Op<unsigned long int>::call(std::forward<Args>(args)...);
+    case TypeKind::LongLong:   return Op<long long int>::call(std::forward<Args>(args)...);
+    case TypeKind::ULongLong:  return Op<unsigned long long int>::call(std::forward<Args>(args)...);
+    case TypeKind::Float:      return Op<float>::call(std::forward<Args>(args)...);
+    case TypeKind::Double:     return Op<double>::call(std::forward<Args>(args)...);
+    case TypeKind::LongDouble: return Op<long double>::call(std::forward<Args>(args)...);
+    default: reflectUnreachable();
+    }
+}
+
+template<typename T>
+struct Load
+{
+    template<typename Target>
+    static Target call(const void* value, Target*)
+    {
+        return Target(*static_cast<const T*>(value));
+    }
+};
+
+template<typename T>
+T load(Operand operand)
+{
+    return dispatch<Load>(operand.kind, operand.value, (T*) nullptr);
+}
+
+
+// Maps a compound assignment operator to its arithmetic operator.
+Operator compoundBase(Operator op)
+{
+    switch (op)
+    {
+    case Operator::PlusAssign:      return Operator::Plus;
+    case Operator::MinusAssign:     return Operator::Minus;
+    case Operator::MultAssign:      return Operator::Mult;
+    case Operator::DivAssign:       return Operator::Div;
+    case Operator::ModAssign:       return Operator::Mod;
+    case Operator::BitAndAssign:    return Operator::BitAnd;
+    case Operator::BitOrAssign:     return Operator::BitOr;
+    case Operator::BitXorAssign:    return Operator::BitXor;
+    case Operator::BitLShiftAssign: return Operator::BitLShift;
+    case Operator::BitRShiftAssign: return Operator::BitRShift;
+    default: return Operator::Size;
+    }
+}
+
+template<typename T>
+bool integerOp(Operator op, T lhs, T rhs, T& out, std::true_type)
+{
+    switch (op)
+    {
+    case Operator::Mod:
+        if (!rhs) reflectError("integer division by zero");
+        out = lhs % rhs;
+        return true;
+
+    case Operator::BitAnd:    out = lhs & rhs;  return true;
+    case Operator::BitOr:     out = lhs | rhs;  return true;
+    case Operator::BitXor:    out = lhs ^ rhs;  return true;
+    case Operator::BitLShift: out = lhs << rhs; return true;
+    case Operator::BitRShift: out = lhs >> rhs; return true;
+    default: return false;
+    }
+}
+
+template<typename T>
+bool integerOp(Operator, T, T, T&, std::false_type) { return false; }
+
+template<typename T>
+bool numberOp(Operator op, T lhs, T rhs, T& out, std::true_type)
+{
+    switch (op)
+    {
+    case Operator::Plus:  out = lhs + rhs; return true;
+    case Operator::Minus: out = lhs - rhs; return true;
+    case Operator::Mult:  out = lhs * rhs; return true;
+
+    case Operator::Div:
+        if (IsInteger<T>::value && !rhs)
+            reflectError("integer division by zero");
+        out = lhs / rhs;
+        return true;
+
+    default: return integerOp(op, lhs, rhs, out, IsInteger<T>());
+    }
+}
+
+template<typename T>
+bool numberOp(Operator, T, T, T&, std::false_type) { return false; }
+
+template<typename T>
+bool bitNot(T value, T& out, std::true_type)
+{
+    out = ~value;
+    return true;
+}
+
+template<typename T>
+bool bitNot(T, T&, std::false_type) { return false; }
+
+
+enum struct OpResult { Unsupported, Self, Stored };
+
+template<typename T>
+struct UnaryOp
+{
+    static OpResult call(
+            Operator op, void* value, bool isConst,
+            std::shared_ptr<void>& storage)
+    {
+        if (!IsNumber<T>::value) return OpResult::Unsupported;
+
+        T& lhs = *static_cast<T*>(value);
+        T out = T();
+
+        switch (op)
+        {
+        case Operator::Inc:
+        case Operator::Dec:
+            if (isConst) return OpResult::Unsupported;
+            lhs = T(op == Operator::Inc ? lhs + 1 : lhs - 1);
+            return OpResult::Self;
+
+        case Operator::BitNot:
+            if (!bitNot(lhs, out, IsInteger<T>())) return OpResult::Unsupported;
+            storage = std::make_shared<T>(out);
+            return OpResult::Stored;
+
+        default: return OpResult::Unsupported;
+        }
+    }
+};
+
+template<typename T>
+struct BinaryOp
+{
+    static OpResult call(
+            Operator op, void* value, bool isConst, Operand operand,
+            std::shared_ptr<void>& storage)
+    {
+        T& lhs = *static_cast<T*>(value);
+        T rhs = load<T>(operand);
+        T out = T();
+
+        if (op == Operator::Assign) {
+            if (isConst) return OpResult::Unsupported;
+            lhs = rhs;
+            return OpResult::Self;
+        }
+
+        // Postfix operators which receive a dummy int operand.
+        if (op == Operator::Inc || op == Operator::Dec) {
+            if (isConst || !IsNumber<T>::value) return OpResult::Unsupported;
+            storage = std::make_shared<T>(lhs);
+            lhs = T(op == Operator::Inc ? lhs + 1 : lhs - 1);
+            return OpResult::Stored;
+        }
+
+        Operator base = compoundBase(op);
+        if (base != Operator::Size) {
+            if (isConst) return OpResult::Unsupported;
+            if (!numberOp(base, lhs, rhs, out, IsNumber<T>()))
+                return OpResult::Unsupported;
+
+            lhs = out;
+            return OpResult::Self;
+        }
+
+        if (!numberOp(op, lhs, rhs, out, IsNumber<T>()))
+            return OpResult::Unsupported;
+
+        storage = std::make_shared<T>(out);
+        return OpResult::Stored;
+    }
+};
+
+template<typename T>
+struct IsSigned
+{
+    static bool call() { return std::is_signed<T>::value; }
+};
+
+template<typename T>
+bool compareOp(Operator op, T lhs, T rhs, bool& out)
+{
+    switch (op)
+    {
+    case Operator::EqComp: out = lhs == rhs; return true;
+    case Operator::NEComp: out = lhs != rhs; return true;
+    case Operator::LTComp: out = lhs <  rhs; return true;
+    case Operator::GTComp: out = lhs >  rhs; return true;
+    case Operator::LEComp: out = lhs <= rhs; return true;
+    case Operator::GEComp: out = lhs >= rhs; return true;
+    default: return false;
+    }
+}
+
+// Unlike the arithmetic operators which work in the type of the lhs,
+// comparisons are carried out on the actual values of both operands such that
+// 10 < 10.5 and -1 < 1u both hold.
+bool compareOp(Operator op, Operand lhs, Operand rhs, bool& out)
+{
+    if (op == Operator::LogicAnd) {
+        out = load<bool>(lhs) && load<bool>(rhs);
+        return true;
+    }
+
+    if (op == Operator::LogicOr) {
+        out = load<bool>(lhs) || load<bool>(rhs);
+        return true;
+    }
+
+    if (lhs.kind >= TypeKind::Float || rhs.kind >= TypeKind::Float)
+        return compareOp(op, load<long double>(lhs), load<long double>(rhs), out);
+
+    bool lhsNeg = dispatch<IsSigned>(lhs.kind) && load<long long>(lhs) < 0;
+    bool rhsNeg = dispatch<IsSigned>(rhs.kind) && load<long long>(rhs) < 0;
+
+    if (lhsNeg != rhsNeg) {
+        // Only the sign matters so compare two stand-ins with the same order.
+        return compareOp(op, lhsNeg ? -1 : 1, rhsNeg ? -1 : 1, out);
+    }
+
+    if (lhsNeg)
+        return compareOp(op, load<long long>(lhs), load<long long>(rhs), out);
+
+    return compareOp(op,
+            load<unsigned long long>(lhs), load<unsigned long long>(rhs), out);
+}
+
+template<typename T>
+struct ToBool
+{
+    static bool call(const void* value)
+    {
+        return bool(*static_cast<const T*>(value));
+    }
+};
+
+} // namespace anonymous
+
+
+Operand
 Value::
-operator bool() const
+operand(const Value& value)
+{
+    return { value.type()->kind(), value.value() };
+}
+
+bool
+Value::
+arithmeticOp(Operator op, Value& result) const
+{
+    if (!type()->isArithmetic()) return false;
+
+    std::shared_ptr<void> storage;
+    switch (dispatch<UnaryOp>(type()->kind(), op, value_, isConst(), storage))
+    {
+    case OpResult::Self: result = *this; return true;
+
+    case OpResult::Stored:
+        result.arg = Argument(type(), RefType::LValue, false);
+        result.value_ = storage.get();
+        result.storage = std::move(storage);
+        return true;
+
+    default: return false;
+    }
+}
+
+bool
+Value::
+arithmeticOp(Operator op, Operand rhs, Value& result) const
+{
+    if (!type()->isArithmetic() || !isArithmetic(rhs.kind)) return false;
+
+    std::shared_ptr<void> storage;
+    switch (dispatch<BinaryOp>(
+                    type()->kind(), op, value_, isConst(), rhs, storage))
+    {
+    case OpResult::Self: result = *this; return true;
+
+    case OpResult::Stored:
+        result.arg = Argument(type(), RefType::LValue, false);
+        result.value_ = storage.get();
+        result.storage = std::move(storage);
+        return true;
+
+    default: return false;
+    }
+}
+
+bool
+Value::
+arithmeticOp(Operator op, Operand rhs, bool& result) const
 {
-    return call<bool>("operator bool()");
+    if (!type()->isArithmetic() || !isArithmetic(rhs.kind)) return false;
+    return compareOp(op, operand(*this), rhs, result);
 }
 
+Value::
+operator bool() const
+{
+    if (type()->isArithmetic())
+        return dispatch<ToBool>(type()->kind(), value_);
+
+    return call<bool>(Operator::Bool);
+}
 
 } // reflect
@@ -35,37 +35,72 @@ struct CleanValue
 };
 
 
+/******************************************************************************/
+/* OPERAND                                                                    */
+/******************************************************************************/
+// Type-erased view of an operand used by the arithmetic fast path of the Value
+// operators. The kind is only meaningful if it's arithmetic.
+
+struct Operand
+{
+    TypeKind kind;
+    const void* value;
+};
+
+
 /******************************************************************************/
 /* VALUE OP                                                                   */
 /******************************************************************************/
 // All operators return Values because there's no clean way to provide a
 // template parameter for the return value when using the operator.
+//
+// When both operands are arithmetic, the operation is carried out directly by
+// switching on their TypeKind. Everything else goes through the operator table
+// of the type which avoids any name lookups.
 
-#define reflectValueOpUnary(op)                 \
-    Value op() const                            \
-    {                                           \
-        return call<Value>(#op);                \
+#define reflectValueOpUnary(op, id)                             \
+    Value op() const                                            \
+    {                                                           \
+        Value result;                                           \
+        if (arithmeticOp(Operator::id, result)) return result;  \
+        return call<Value>(Operator::id);                       \
     }
 
-#define reflectValueOpBinary(op)                                \
-    template<typename Arg>                                      \
-    Value op(Arg&& arg) const                                   \
-    {                                                           \
-        return call<Value>(#op, std::forward<Arg>(arg));        \
+#define reflectValueOpBinary(op, id)                                    \
+    template<typename Arg>                                              \
+    Value op(Arg&& arg) const                                           \
+    {                                                                   \
+        Value result;                                                   \
+        if (arithmeticOp(Operator::id, operand(arg), result))           \
+            return result;                                              \
+        return call<Value>(Operator::id, std::forward<Arg>(arg));       \
     }
 
-#define reflectValueOpBool(op)                          \
-    template<typename Arg>                              \
-    bool op(Arg&& arg) const                            \
-    {                                                   \
-        return call<bool>(#op, std::forward<Arg>(arg)); \
+#define reflectValueOpPostfix(op, id)                                   \
+    Value op(int) const                                                 \
+    {                                                                   \
+        int dummy = 0;                                                  \
+        Value result;                                                   \
+        if (arithmeticOp(Operator::id, operand(dummy), result))         \
+            return result;                                              \
+        return call<Value>(Operator::id, dummy);                        \
     }
 
-#define reflectValueOpNary(op)                                  \
-    template<typename... Args>                                  \
-    Value op(Args&&... args) const                              \
-    {                                                           \
-        return call<Value>(#op, std::forward<Args>(args)...);   \
+#define reflectValueOpBool(op, id)                                      \
+    template<typename Arg>                                              \
+    bool op(Arg&& arg) const                                            \
+    {                                                                   \
+        bool result;                                                    \
+        if (arithmeticOp(Operator::id, operand(arg), result))           \
+            return result;                                              \
+        return call<bool>(Operator::id, std::forward<Arg>(arg));        \
+    }
+
+#define reflectValueOpNary(op, id)                                      \
+    template<typename... Args>                                          \
+    Value op(Args&&... args) const                                      \
+    {                                                                   \
+        return call<Value>(Operator::id, std::forward<Args>(args)...);  \
     }
 
 
@@ -80,6 +115,9 @@ struct Value
     template<typename T>
     explicit Value(T&& value);
 
+    // l-value reference to an existing object of the given type.
+    Value(const Type* type, void* value, bool isConst = false);
+
     Value(Value& other);
     Value(const Value& other);
     Value& operator=(const Value& other);
@@ -104,6 +142,7 @@ struct Value
 
     template<typename T> auto cast() const -> typename CleanRef<T>::type;
     template<typename T> bool isCastable() const;
+    template<typename T> auto tryCast() const -> Result<typename CleanRef<T>::type>;
 
     template<typename T> auto copy() const -> typename CleanValue<T>::type;
     template<typename T> bool isCopiable() const;
@@ -115,58 +154,73 @@ struct Value
     Value copy() const;
     Value move();
 
+    // Dereferences a pointer without going through its operator*. Returns a
+    // void Value if the pointer is null.
+    Value pointee() const;
+
     template<typename Ret, typename... Args>
     Ret call(const std::string& fn, Args&&... args) const;
 
+    template<typename Ret, typename... Args>
+    Ret call(Operator op, Args&&... args) const;
+
     template<typename Ret = Value>
     Ret field(const std::string& field) const;
 
+    // Exception-free variants of call and field. Errors are reported through
+    // the returned Result and are only formatted on demand.
+    template<typename Ret, typename... Args>
+    Result<Ret> tryCall(const std::string& fn, Args&&... args) const;
+
+    template<typename Ret = Value>
+    Result<Ret> tryField(const std::string& field) const;
+
     // operator= for the contained value.
     template<typename Arg>
     void assign(Arg&& arg) const;
 
-    reflectValueOpBinary(operator+=)
-    reflectValueOpBinary(operator-=)
-    reflectValueOpBinary(operator*=)
-    reflectValueOpBinary(operator/=)
-    reflectValueOpBinary(operator%=)
-    reflectValueOpBinary(operator&=)
-    reflectValueOpBinary(operator|=)
-    reflectValueOpBinary(operator^=)
-    reflectValueOpBinary(operator<<=)
-    reflectValueOpBinary(operator>>=)
-
-    reflectValueOpUnary (operator++)
-    reflectValueOpBinary(operator++)
-    reflectValueOpUnary (operator--)
-    reflectValueOpBinary(operator--)
-
-    reflectValueOpBinary(operator+)
-    reflectValueOpBinary(operator-)
-    reflectValueOpBinary(operator*)
-    reflectValueOpBinary(operator/)
-    reflectValueOpBinary(operator%)
-    reflectValueOpUnary (operator~)
-    reflectValueOpBinary(operator&)
-    reflectValueOpBinary(operator|)
-    reflectValueOpBinary(operator^)
-    reflectValueOpBinary(operator<<)
-    reflectValueOpBinary(operator>>)
+    reflectValueOpBinary(operator+=,  PlusAssign)
+    reflectValueOpBinary(operator-=,  MinusAssign)
+    reflectValueOpBinary(operator*=,  MultAssign)
+    reflectValueOpBinary(operator/=,  DivAssign)
+    reflectValueOpBinary(operator%=,  ModAssign)
+    reflectValueOpBinary(operator&=,  BitAndAssign)
+    reflectValueOpBinary(operator|=,  BitOrAssign)
+    reflectValueOpBinary(operator^=,  BitXorAssign)
+    reflectValueOpBinary(operator<<=, BitLShiftAssign)
+    reflectValueOpBinary(operator>>=, BitRShiftAssign)
+
+    reflectValueOpUnary  (operator++, Inc)
+    reflectValueOpPostfix(operator++, Inc)
+    reflectValueOpUnary  (operator--, Dec)
+    reflectValueOpPostfix(operator--, Dec)
+
+    reflectValueOpBinary(operator+,  Plus)
+    reflectValueOpBinary(operator-,  Minus)
+    reflectValueOpBinary(operator*,  Mult)
+    reflectValueOpBinary(operator/,  Div)
+    reflectValueOpBinary(operator%,  Mod)
+    reflectValueOpUnary (operator~,  BitNot)
+    reflectValueOpBinary(operator&,  BitAnd)
+    reflectValueOpBinary(operator|,  BitOr)
+    reflectValueOpBinary(operator^,  BitXor)
+    reflectValueOpBinary(operator<<, BitLShift)
+    reflectValueOpBinary(operator>>, BitRShift)
 
     bool operator!() const;
-    reflectValueOpBool(operator&&)
-    reflectValueOpBool(operator||)
+    reflectValueOpBool(operator&&, LogicAnd)
+    reflectValueOpBool(operator||, LogicOr)
 
-    reflectValueOpBool(operator==)
-    reflectValueOpBool(operator!=)
-    reflectValueOpBool(operator<)
-    reflectValueOpBool(operator>)
-    reflectValueOpBool(operator<=)
-    reflectValueOpBool(operator>=)
+    reflectValueOpBool(operator==, EqComp)
+    reflectValueOpBool(operator!=, NEComp)
+    reflectValueOpBool(operator<,  LTComp)
+    reflectValueOpBool(operator>,  GTComp)
+    reflectValueOpBool(operator<=, LEComp)
+    reflectValueOpBool(operator>=, GEComp)
 
-    reflectValueOpNary  (operator())
-    reflectValueOpBinary(operator[])
-    reflectValueOpUnary (operator*)
+    reflectValueOpNary  (operator(), Function)
+    reflectValueOpBinary(operator[], Array)
+    reflectValueOpUnary (operator*,  Mult)
 
     explicit operator bool() const;
 
@@ -175,6 +229,20 @@ private:
     template<typename T>
     T convert() const;
 
+    Value fieldValue(const Field& field) const;
+
+    static Operand operand(const Value& value);
+
+    template<typename T>
+    static Operand operand(const T& value)
+    {
+        return { TypeKindOf<T>::value, &value };
+    }
+
+    bool arithmeticOp(Operator op, Value& result) const;
+    bool arithmeticOp(Operator op, Operand rhs, Value& result) const;
+    bool arithmeticOp(Operator op, Operand rhs, bool& result) const;
+
     Argument arg;
     void* value_;
     std::shared_ptr<void> storage;
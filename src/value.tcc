@@ -24,36 +24,28 @@ struct IsMovable
     typedef std::integral_constant<bool, value> type;
 };
 
-template<typename T>
-struct ValueDestructor
-{
-    void operator() (void* ptr) const
-    {
-        static_cast<T*>(ptr)->~T();
-    }
-};
-
 
 /******************************************************************************/
 /* VALUE                                                                      */
 /******************************************************************************/
 
+// The value and its control block are allocated in a single block.
 template<typename T, typename Meh>
-void* store(T&& value, std::true_type, Meh)
+std::shared_ptr<void> store(T&& value, std::true_type, Meh)
 {
     typedef typename std::decay<T>::type CleanT;
-    return new CleanT(std::move(value));
+    return std::make_shared<CleanT>(std::move(value));
 }
 
 template<typename T>
-void* store(T&& value, std::false_type, std::true_type)
+std::shared_ptr<void> store(T&& value, std::false_type, std::true_type)
 {
     typedef typename std::decay<T>::type CleanT;
-    return new CleanT(value);
+    return std::make_shared<CleanT>(value);
 }
 
 template<typename T, typename... Rest>
-void* store(Rest&&...)
+std::shared_ptr<void> store(Rest&&...)
 {
     reflectError(
             "<%s> cannot be stored (no move/copy constructor)",
@@ -70,11 +62,10 @@ Value(T&& value) :
 
     typedef typename std::decay<T>::type CleanT;
 
-    value_ = store<T>(std::forward<T>(value),
+    storage = store<T>(std::forward<T>(value),
             typename IsMovable<T>::type(),
             typename std::is_copy_constructible<CleanT>::type());
-
-    storage.reset(value_, ValueDestructor<CleanT>());
+    value_ = storage.get();
 
     // We now own the value so we're now l-ref-ing our internal storage.
     arg = Argument(arg.type(), RefType::LValue, false);
@@ -120,6 +111,18 @@ cast() const -> typename CleanRef<T>::type
     return *static_cast<CleanT*>(value_);
 }
 
+template<typename T>
+auto
+Value::
+tryCast() const -> Result<typename CleanRef<T>::type>
+{
+    if (!isCastable<T>())
+        return Failure::cast(arg, Argument::make<T>());
+
+    typedef typename std::decay<T>::type CleanT;
+    return *static_cast<CleanT*>(value_);
+}
+
 
 template<typename T>
 T
@@ -129,7 +132,7 @@ convert() const
     reflectStaticAssert((std::is_same< T, typename std::decay<T>::type>::value));
 
     auto& converter = type()->converter<T>();
-    return converter.call<T>(*this);
+    return converter.template call<T>(*this);
 }
 
 
@@ -193,7 +196,7 @@ move() -> typename CleanValue<T>::type
         convert<CleanT>();
 
     *this = Value();
-    return std::move(value);
+    return value;
 }
 
 
@@ -206,17 +209,48 @@ call(const std::string& fn, Args&&... args) const
     return f.call<Ret>(*this, std::forward<Args>(args)...);
 }
 
+template<typename Ret, typename... Args>
+Ret
+Value::
+call(Operator op, Args&&... args) const
+{
+    const auto& f = type()->function(op);
+    return f.call<Ret>(*this, std::forward<Args>(args)...);
+}
+
 template<typename Ret>
 Ret
 Value::
 field(const std::string& field) const
 {
-    const auto& f = type()->field(field);
-    bool isConst = f.argument().isConst() || this->isConst();
+    return retCast<Ret>(fieldValue(type()->field(field)));
+}
+
+template<typename Ret, typename... Args>
+Result<Ret>
+Value::
+tryCall(const std::string& fn, Args&&... args) const
+{
+    auto f = type()->tryFunction(fn);
+    if (!f) return f.failure();
 
-    Value value;
-    value.arg = Argument(f.type(), RefType::LValue, isConst);
-    value.value_ = static_cast<uint8_t*>(value_) + f.offset();
+    return f.value().tryCall<Ret>(*this, std::forward<Args>(args)...);
+}
+
+template<typename Ret>
+Result<Ret>
+Value::
+tryField(const std::string& field) const
+{
+    auto f = type()->tryField(field);
+    if (!f) return f.failure();
+
+    Value value = fieldValue(f.value());
+
+    if (!std::is_same<typename std::decay<Ret>::type, Value>::value) {
+        if (value.argument().isConvertibleTo<Ret>() == Match::None)
+            return Failure::cast(value.argument(), Argument::make<Ret>());
+    }
 
     return retCast<Ret>(value);
 }
@@ -226,7 +260,9 @@ void
 Value::
 assign(Arg&& arg) const
 {
-    call<void>("operator=", std::forward<Arg>(arg));
+    Value result;
+    if (arithmeticOp(Operator::Assign, operand(arg), result)) return;
+    call<void>(Operator::Assign, std::forward<Arg>(arg));
 }
 
 
@@ -0,0 +1,173 @@
+/* arena_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the monotonic arena and the emplace hooks of shared pointers.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "reflect.h"
+#include "types/primitives.h"
+#include "types/std/string.h"
+#include "types/std/smart_ptr.h"
+#include "dsl/all.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* TYPES                                                                      */
+/******************************************************************************/
+
+namespace test {
+
+struct Counted
+{
+    Counted() : value(0) { alive++; }
+    ~Counted() { alive--; }
+
+    int64_t value;
+    static size_t alive;
+};
+
+size_t Counted::alive = 0;
+
+// Not default constructible so it doesn't get the emplace hooks.
+struct Fixed
+{
+    explicit Fixed(int64_t value) : value(value) {}
+    int64_t value;
+};
+
+} // namespace test
+
+reflectType(test::Counted)
+{
+    reflectPlumbing();
+    reflectField(value);
+}
+
+reflectType(test::Fixed)
+{
+    reflectField(value);
+}
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_allocate)
+{
+    Arena arena(1024);
+    BOOST_CHECK_EQUAL(arena.capacity(), 0u);
+
+    char* first = static_cast<char*>(arena.allocate(1, 1));
+    BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+
+    // Allocations are carved out of the same block in order.
+    int64_t* aligned = arena.allocate<int64_t>(2);
+    BOOST_CHECK_EQUAL(uintptr_t(aligned) % alignof(int64_t), 0u);
+    BOOST_CHECK_EQUAL(reinterpret_cast<char*>(aligned), first + alignof(int64_t));
+
+    // Oversized allocations leave the current block alone.
+    void* large = arena.allocate(4096, 16);
+    BOOST_CHECK_EQUAL(uintptr_t(large) % 16, 0u);
+    BOOST_CHECK_EQUAL(arena.allocate(1, 1), first + alignof(int64_t) + 16);
+
+    // Filling up the block moves on to a new one.
+    for (size_t i = 0; i < 64; ++i) arena.allocate(64, 8);
+    BOOST_CHECK_GT(arena.capacity(), 1024u + 4096u);
+
+    // Only the current block is kept around.
+    arena.release();
+    BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+    void* next = arena.allocate(8, 8);
+    BOOST_CHECK(next != nullptr);
+    BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+}
+
+BOOST_AUTO_TEST_CASE(test_absorb)
+{
+    Arena arena(1024);
+    Arena empty(1024);
+    arena.absorb(empty);
+    BOOST_CHECK_EQUAL(arena.capacity(), 0u);
+
+    Arena other(1024);
+    int64_t* value = other.allocate<int64_t>();
+    *value = 10;
+
+    // Blocks are moved over without being copied.
+    arena.absorb(other);
+    BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+    BOOST_CHECK_EQUAL(other.capacity(), 0u);
+    BOOST_CHECK_EQUAL(*value, 10);
+
+    // The current block of the other arena is carved from when we had none.
+    BOOST_CHECK_EQUAL(arena.allocate<int64_t>(), value + 1);
+
+    other.allocate(8, 8);
+    arena.absorb(other);
+    BOOST_CHECK_EQUAL(arena.capacity(), 2048u);
+    BOOST_CHECK_EQUAL(arena.allocate<int64_t>(), value + 2);
+
+    // Absorbed blocks are freed along with the others.
+    arena.release();
+    BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+}
+
+BOOST_AUTO_TEST_CASE(test_allocator)
+{
+    Arena arena;
+
+    {
+        std::vector<int64_t, ArenaAllocator<int64_t> > vec{ArenaAllocator<int64_t>(arena)};
+        for (int64_t i = 0; i < 1000; ++i) vec.push_back(i);
+        BOOST_CHECK_EQUAL(vec[999], 999);
+    }
+
+    ArenaAllocator<int64_t> a(arena);
+    ArenaAllocator<char> b(a);
+    BOOST_CHECK(a == b);
+
+    Arena other;
+    BOOST_CHECK(a != ArenaAllocator<char>(other));
+}
+
+BOOST_AUTO_TEST_CASE(test_emplace)
+{
+    typedef std::shared_ptr<test::Counted> Ptr;
+    const Type* type = reflect::type<Ptr>();
+    BOOST_CHECK(type->hasFunction("emplace"));
+    BOOST_CHECK(!reflect::type< std::shared_ptr<test::Fixed> >()->hasFunction("emplace"));
+
+    Ptr ptr;
+    Value value(ptr);
+
+    Value pointee = value.call<Value>("emplace");
+    BOOST_REQUIRE(ptr);
+    BOOST_CHECK_EQUAL(pointee.get<test::Counted>().value, 0);
+    BOOST_CHECK_EQUAL(&pointee.get<test::Counted>(), ptr.get());
+
+    {
+        Arena arena;
+
+        pointee = value.call<Value>("emplace", arena);
+        pointee.cast<test::Counted&>().value = 10;
+        BOOST_CHECK_EQUAL(ptr->value, 10);
+        BOOST_CHECK_EQUAL(test::Counted::alive, 1u);
+
+        Ptr copy = ptr;
+        ptr.reset();
+        BOOST_CHECK_EQUAL(test::Counted::alive, 1u);
+
+        // Destruction still goes through the destructor.
+        copy.reset();
+        BOOST_CHECK_EQUAL(test::Counted::alive, 0u);
+    }
+}
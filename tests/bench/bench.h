@@ -0,0 +1,67 @@
+/* bench.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tiny benchmarking harness.
+
+   Benchmarks are plain executables that print the time per iteration of each
+   of their runs. They're not part of the test suite since their results are
+   only meaningful when compared against each other on a quiet machine.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+namespace reflect {
+namespace bench {
+
+/******************************************************************************/
+/* SINK                                                                       */
+/******************************************************************************/
+
+// Keeps the optimizer from throwing away the benchmarked computations.
+template<typename T>
+void sink(T&& value)
+{
+    asm volatile("" : : "r" (&value) : "memory");
+}
+
+
+/******************************************************************************/
+/* ITERATIONS                                                                 */
+/******************************************************************************/
+
+inline size_t iterations(int argc, char** argv, size_t def)
+{
+    return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : def;
+}
+
+
+/******************************************************************************/
+/* RUN                                                                        */
+/******************************************************************************/
+
+template<typename Fn>
+double run(const std::string& name, size_t n, Fn&& fn)
+{
+    typedef std::chrono::high_resolution_clock Clock;
+
+    fn(); // warm up.
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < n; ++i) fn();
+    auto end = Clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    double perIt = ns / n;
+
+    std::printf("%-40s %12.2f ns/it\n", name.c_str(), perIt);
+    return perIt;
+}
+
+} // namespace bench
+} // namespace reflect
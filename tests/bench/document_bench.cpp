@@ -0,0 +1,109 @@
+/* document_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Untyped parsing into nested Values versus the tape based document, both in
+   time and in memory, for documents shaped like tests/utils/json/generic.json.
+*/
+
+#include "reflect.h"
+#include "utils/json.h"
+#include "bench.h"
+
+#include <atomic>
+#include <new>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* ALLOCATIONS                                                                */
+/******************************************************************************/
+
+std::atomic<size_t> allocated(0);
+
+void* operator new(size_t size)
+{
+    allocated += size;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+template<typename Fn>
+size_t measure(Fn&& fn)
+{
+    size_t start = allocated;
+    fn();
+    return allocated - start;
+}
+
+
+/******************************************************************************/
+/* DOCUMENT                                                                   */
+/******************************************************************************/
+
+std::string makeDocument(size_t records)
+{
+    std::stringstream ss;
+    ss << "[\n";
+
+    for (size_t i = 0; i < records; ++i) {
+        if (i) ss << ",\n";
+        ss  << "{ \"null\": null, \"bool\": true, \"int\": " << i
+            << ", \"float\": " << i << ".321, \"string\": \"abc" << i << "\""
+            << ", \"array\": [ 1, [ 2 ], { \"3\": 4 } ]"
+            << ", \"object\": { \"a\": 1, \"b\": [ 2 ], \"c\": { \"3\": 4 } } }";
+    }
+
+    ss << "\n]\n";
+    return ss.str();
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 10);
+
+    std::string doc = makeDocument(10 * 1000);
+    std::printf("document: %zu bytes\n", doc.size());
+
+    {
+        Value value;
+        size_t bytes = measure([&] { json::parse(doc, value); });
+        std::printf("%-40s %12zu bytes\n", "memory.value", bytes);
+
+        json::Document document;
+        bytes = measure([&] { json::parse(doc, document); });
+        std::printf("%-40s %12zu bytes (%zu retained)\n",
+                "memory.document", bytes, document.memory());
+    }
+
+    bench::run("parse.value", n, [&] {
+                Value value;
+                json::parse(doc, value);
+                bench::sink(value);
+            });
+
+    bench::run("parse.document", n, [&] {
+                json::Document document;
+                json::parse(doc, document);
+                bench::sink(document);
+            });
+
+    json::Document document;
+    json::parse(doc, document);
+
+    bench::run("lookup.document", n, [&] {
+                int64_t sum = 0;
+                for (json::Node record : document.root())
+                    sum += record.at("object").at("c").at("3").asInt();
+                bench::sink(sum);
+            });
+}
@@ -0,0 +1,58 @@
+/* file_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parsing and printing a file through the standard streams versus through a
+   memory mapping and a block buffered writer.
+*/
+
+#include "utils/json.h"
+#include "records.h"
+#include "bench.h"
+
+#include <fstream>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 10);
+
+    char path[] = "/tmp/reflect_file_bench_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) reflectError("unable to create temp file");
+    ::close(fd);
+
+    std::vector<Record> records = makeRecords(200 * 1000);
+
+    bench::run("print.stream", n, [&] {
+                std::ofstream stream(path);
+                bench::sink(json::print(stream, records));
+            });
+
+    bench::run("print.file", n, [&] {
+                bench::sink(json::printFile(path, records));
+            });
+
+    bench::run("parse.stream", n, [&] {
+                std::ifstream stream(path);
+                std::vector<Record> value;
+                json::parse(stream, value);
+                bench::sink(value);
+            });
+
+    bench::run("parse.file", n, [&] {
+                std::vector<Record> value;
+                json::parseFile(path, value);
+                bench::sink(value);
+            });
+
+    std::remove(path);
+}
@@ -0,0 +1,142 @@
+/* json_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Statically specialized json codec versus the dynamic Value based codec on
+   the same document.
+*/
+
+#include "reflect.h"
+#include "utils/json.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "types/std/smart_ptr.h"
+#include "bench.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* RECORDS                                                                    */
+/******************************************************************************/
+
+struct Item
+{
+    int64_t id;
+    double price;
+    std::string name;
+    std::vector<int64_t> tags;
+    bool active;
+};
+
+reflectStaticFields(Item, id, price, name, tags, active)
+
+reflectType(Item)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+}
+
+struct Order
+{
+    int64_t id;
+    std::string customer;
+    std::vector<Item> items;
+    std::map<std::string, int64_t> counts;
+    std::shared_ptr<Item> featured;
+};
+
+reflectStaticFields(Order, id, customer, items, counts, featured)
+
+reflectType(Order)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+    reflectFieldValue(customer, json, json::alias("who"));
+}
+
+std::vector<Order> makeOrders(size_t orders, size_t items)
+{
+    std::vector<Order> result(orders);
+
+    for (size_t i = 0; i < orders; ++i) {
+        Order& order = result[i];
+        order.id = i;
+        order.customer = "customer" + std::to_string(i);
+        order.counts["views"] = i * 3;
+        order.counts["clicks"] = i;
+
+        for (size_t j = 0; j < items; ++j) {
+            Item item;
+            item.id = j;
+            item.price = j * 1.5;
+            item.name = "item" + std::to_string(j);
+            item.tags = { int64_t(j), int64_t(j + 1), int64_t(j + 2) };
+            item.active = j % 2;
+            order.items.push_back(std::move(item));
+        }
+
+        order.featured = std::make_shared<Item>(order.items.front());
+    }
+
+    return result;
+}
+
+
+/******************************************************************************/
+/* DYNAMIC                                                                    */
+/******************************************************************************/
+
+std::string printDynamic(const std::vector<Order>& orders)
+{
+    std::ostringstream stream;
+    json::Writer writer(stream);
+    json::print(writer, cast<Value>(orders));
+    return stream.str();
+}
+
+void parseDynamic(const std::string& str, std::vector<Order>& orders)
+{
+    std::istringstream stream(str);
+    json::Reader reader(stream);
+
+    Value value = cast<Value>(orders);
+    json::parse(reader, value);
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 100);
+
+    auto orders = makeOrders(100, 10);
+    std::string json = json::print(orders).first;
+
+    if (json != printDynamic(orders)) {
+        std::printf("static and dynamic output differ\n");
+        return 1;
+    }
+
+    bench::run("print.static", n, [&] { bench::sink(json::print(orders)); });
+    bench::run("print.dynamic", n, [&] { bench::sink(printDynamic(orders)); });
+
+    bench::run("parse.static", n, [&] {
+                std::vector<Order> value;
+                bench::sink(json::parse(json, value));
+            });
+
+    bench::run("parse.dynamic", n, [&] {
+                std::vector<Order> value;
+                parseDynamic(json, value);
+                bench::sink(value);
+            });
+}
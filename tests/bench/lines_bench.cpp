@@ -0,0 +1,65 @@
+/* lines_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parallel json lines parsing versus a single-threaded loop that parses one
+   line at a time.
+*/
+
+#include "utils/json.h"
+#include "records.h"
+#include "bench.h"
+
+#include <thread>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+std::string makeLines(size_t records)
+{
+    std::string lines;
+    for (size_t i = 0; i < records; ++i) lines += recordJson(i) + "\n";
+    return lines;
+}
+
+std::vector<Record> parseLoop(const std::string& input)
+{
+    std::vector<Record> records;
+    std::istringstream stream(input);
+
+    std::string line;
+    while (std::getline(stream, line)) {
+        Record record;
+        if (!json::parse(line, record)) records.push_back(std::move(record));
+    }
+
+    return records;
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 10);
+
+    std::string input = makeLines(200 * 1000);
+    size_t cores = std::thread::hardware_concurrency();
+    std::printf("input: %zu bytes, cores: %zu\n", input.size(), cores);
+
+    bench::run("lines.loop", n, [&] { bench::sink(parseLoop(input)); });
+
+    for (size_t threads : { size_t(1), size_t(2), size_t(4), cores }) {
+        bench::run("lines.threads." + std::to_string(threads), n, [&] {
+                    std::vector<Record> records;
+                    bench::sink(json::parseLines(input, records, threads));
+                    bench::sink(records);
+                });
+    }
+}
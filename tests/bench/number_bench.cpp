@@ -0,0 +1,104 @@
+/* number_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Number heavy documents: arrays of doubles and records made mostly of int64
+   ids.
+*/
+
+#include "reflect.h"
+#include "utils/json.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/vector.h"
+#include "bench.h"
+
+#include <random>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* DOCUMENTS                                                                  */
+/******************************************************************************/
+
+struct Sample
+{
+    int64_t id;
+    int64_t parent;
+    int64_t timestamp;
+    double x;
+    double y;
+};
+
+reflectStaticFields(Sample, id, parent, timestamp, x, y)
+
+reflectType(Sample)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+}
+
+std::vector<double> makeDoubles(size_t n)
+{
+    std::mt19937_64 rng(0);
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+
+    std::vector<double> result(n);
+    for (double& value : result) value = dist(rng);
+    return result;
+}
+
+std::vector<Sample> makeSamples(size_t n)
+{
+    std::mt19937_64 rng(0);
+    std::uniform_real_distribution<double> dist(0, 1);
+
+    std::vector<Sample> result(n);
+    for (size_t i = 0; i < n; ++i) {
+        Sample& sample = result[i];
+        sample.id = int64_t(rng() >> 1);
+        sample.parent = int64_t(rng() >> 20);
+        sample.timestamp = 1500000000000 + i;
+        sample.x = int64_t(dist(rng) * 1000000) / 1000.0;
+        sample.y = int64_t(dist(rng) * 1000000) / 1000.0;
+    }
+    return result;
+}
+
+size_t tokenize(const std::string& str)
+{
+    size_t tokens = 0;
+    json::Reader reader(str);
+    while (reader.nextToken().type() != json::Token::EOS) tokens++;
+    return tokens;
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 10);
+
+    std::string doubles = json::print(makeDoubles(100 * 1000)).first;
+    std::string samples = json::print(makeSamples(100 * 1000)).first;
+    std::printf("doubles: %zu bytes, samples: %zu bytes\n",
+            doubles.size(), samples.size());
+
+    bench::run("tokenize.doubles", n, [&] { bench::sink(tokenize(doubles)); });
+    bench::run("tokenize.samples", n, [&] { bench::sink(tokenize(samples)); });
+
+    bench::run("parse.doubles", n, [&] {
+                std::vector<double> value;
+                bench::sink(json::parse(doubles, value));
+            });
+
+    bench::run("parse.samples", n, [&] {
+                std::vector<Sample> value;
+                bench::sink(json::parse(samples, value));
+            });
+}
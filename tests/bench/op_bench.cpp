@@ -0,0 +1,63 @@
+/* op_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Value operators on arithmetic values versus reflected operators.
+*/
+
+#include "reflect.h"
+#include "dsl/all.h"
+#include "bench.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* COUNTER                                                                    */
+/******************************************************************************/
+
+struct Counter
+{
+    Counter() : value(0) {}
+
+    int value;
+
+    Counter& operator+=(int v) { value += v; return *this; }
+    bool operator<(int v) const { return value < v; }
+};
+
+reflectType(Counter)
+{
+    reflectPlumbing();
+    reflectOp(operator+=, PlusAssign);
+    reflectOp(operator<, LTComp);
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 1000000);
+
+    int i = 0;
+    Value value(i);
+    Value one(1);
+
+    bench::run("int.plus", n, [&] { bench::sink(value + 1); });
+    bench::run("int.plus.value", n, [&] { bench::sink(value + one); });
+    bench::run("int.plusAssign", n, [&] { bench::sink(value += 1); });
+    bench::run("int.less", n, [&] { bench::sink(value < 10.5); });
+    bench::run("int.bool", n, [&] { bench::sink((bool) value); });
+
+    Counter c;
+    Value counter(c);
+
+    bench::run("object.plusAssign", n, [&] { bench::sink(counter += 1); });
+    bench::run("object.less", n, [&] { bench::sink(counter < 10); });
+    bench::run("object.call", n, [&] {
+                bench::sink(counter.call<Value>("operator+=", 1));
+            });
+}
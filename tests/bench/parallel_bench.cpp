@@ -0,0 +1,59 @@
+/* parallel_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parallel parsing of a large top-level array versus the sequential parser
+   along with the cost of building the structural index on its own.
+*/
+
+#include "utils/json.h"
+#include "records.h"
+#include "bench.h"
+
+#include <thread>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+std::string makeArray(size_t records)
+{
+    std::string array = "[\n";
+    for (size_t i = 0; i < records; ++i)
+        array += (i ? ",\n  " : "  ") + recordJson(i);
+    return array + "\n]\n";
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 10);
+
+    std::string input = makeArray(200 * 1000);
+    size_t cores = std::thread::hardware_concurrency();
+    std::printf("input: %zu bytes, cores: %zu\n", input.size(), cores);
+
+    bench::run("index", n, [&] {
+                std::vector<uint32_t> index;
+                json::details::indexStructurals(
+                        input.data(), input.data() + input.size(), index);
+                bench::sink(index);
+            });
+
+    for (size_t threads : { size_t(1), size_t(2), size_t(4), cores }) {
+        json::parallelThreads(threads);
+
+        bench::run("array.threads." + std::to_string(threads), n, [&] {
+                    std::vector<Record> records;
+                    bench::sink(json::parse(input, records));
+                    bench::sink(records);
+                });
+    }
+}
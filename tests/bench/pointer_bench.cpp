@@ -0,0 +1,106 @@
+/* pointer_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   JSON round-trip of a pointer heavy document along with the raw cost of a
+   dereference through the pointer getter versus the reflected operator*.
+*/
+
+#include "reflect.h"
+#include "utils/json.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "types/std/smart_ptr.h"
+#include "bench.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* GRAPH                                                                      */
+/******************************************************************************/
+
+struct Leaf
+{
+    int64_t id;
+    std::string name;
+};
+
+reflectType(Leaf)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(id);
+    reflectField(name);
+}
+
+struct Node
+{
+    std::shared_ptr<Leaf> leaf;
+    std::vector< std::shared_ptr<Leaf> > children;
+};
+
+reflectType(Node)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(leaf);
+    reflectField(children);
+}
+
+std::vector< std::shared_ptr<Node> > makeGraph(size_t nodes, size_t children)
+{
+    std::vector< std::shared_ptr<Node> > graph;
+
+    for (size_t i = 0; i < nodes; ++i) {
+        auto node = std::make_shared<Node>();
+        node->leaf = std::make_shared<Leaf>(Leaf{ int64_t(i), "node" });
+
+        for (size_t j = 0; j < children; ++j) {
+            node->children.emplace_back(
+                    std::make_shared<Leaf>(Leaf{ int64_t(j), "child" }));
+        }
+
+        graph.emplace_back(std::move(node));
+    }
+
+    return graph;
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 100);
+
+    auto graph = makeGraph(100, 10);
+    std::string json = json::print(graph).first;
+
+    bench::run("json.print", n, [&] { bench::sink(json::print(graph)); });
+    bench::run("json.parse", n, [&] {
+                std::vector< std::shared_ptr<Node> > value;
+                bench::sink(json::parse(json, value));
+            });
+
+    Arena arena;
+    bench::run("json.parse.arena", n, [&] {
+                {
+                    std::vector< std::shared_ptr<Node> > value;
+                    bench::sink(json::parse(json, value, arena));
+                }
+                arena.release();
+            });
+
+    std::shared_ptr<Leaf> leaf = graph.front()->leaf;
+    Value ptr(leaf);
+
+    bench::run("deref.pointee", n * 1000, [&] { bench::sink(ptr.pointee()); });
+    bench::run("deref.operator", n * 1000, [&] {
+                if (ptr) bench::sink(*ptr);
+            });
+}
@@ -0,0 +1,105 @@
+/* projection_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Parsing a handful of fields out of wide records versus parsing the entire
+   records, with and without validating what is skipped.
+*/
+
+#include "reflect.h"
+#include "utils/json.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "bench.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* RECORD                                                                     */
+/******************************************************************************/
+
+struct Record
+{
+    Record() : id(0), price(0) {}
+
+    int64_t id;
+    std::string name;
+    std::map<std::string, std::string> attributes;
+    std::vector<int64_t> history;
+    double price;
+};
+
+reflectType(Record)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(id);
+    reflectField(name);
+    reflectField(attributes);
+    reflectField(history);
+    reflectField(price);
+}
+
+// Roughly 200 fields of which only 3 are of interest.
+std::string makeRecord()
+{
+    std::stringstream ss;
+    ss << "{ \"id\": 42, \"name\": \"record\", \"attributes\": {";
+
+    for (size_t i = 0; i < 150; ++i) {
+        if (i) ss << ", ";
+        ss << "\"attr" << i << "\": \"value of attribute " << i << "\"";
+    }
+
+    ss << " }, \"history\": [";
+    for (size_t i = 0; i < 50; ++i) ss << (i ? ", " : " ") << i * 1000;
+
+    ss << " ], \"price\": 12.5 }";
+    return ss.str();
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 100 * 1000);
+
+    std::string input = makeRecord();
+    std::printf("record: %zu bytes\n", input.size());
+
+    json::Projection head(type<Record>(), { "id", "name" });
+    json::Projection tail(type<Record>(), { "id", "name", "price" });
+    json::Projection validate(
+            type<Record>(), { "id", "name", "price" }, json::Projection::Validate);
+
+    bench::run("parse.full", n, [&] {
+                Record record;
+                json::parse(input, record);
+                bench::sink(record);
+            });
+
+    bench::run("project.head", n, [&] {
+                Record record;
+                json::parse(input, record, head);
+                bench::sink(record);
+            });
+
+    bench::run("project.tail", n, [&] {
+                Record record;
+                json::parse(input, record, tail);
+                bench::sink(record);
+            });
+
+    bench::run("project.validate", n, [&] {
+                Record record;
+                json::parse(input, record, validate);
+                bench::sink(record);
+            });
+}
@@ -0,0 +1,118 @@
+/* raw_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Round-tripping a record with a large payload that is only forwarded, either
+   fully parsed, captured as raw bytes or lazily parsed.
+*/
+
+#include "reflect.h"
+#include "utils/json.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "bench.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* RECORD                                                                     */
+/******************************************************************************/
+
+struct Payload
+{
+    std::map<std::string, std::string> attributes;
+    std::vector<int64_t> history;
+};
+
+reflectType(Payload)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(attributes);
+    reflectField(history);
+}
+
+template<typename T>
+struct Record
+{
+    Record() : id(0) {}
+
+    int64_t id;
+    std::string name;
+    T payload;
+};
+
+reflectTemplate(Record, T)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(id);
+    reflectField(name);
+    reflectField(payload);
+}
+
+std::string makeRecord()
+{
+    std::stringstream ss;
+    ss << "{ \"id\": 42, \"name\": \"record\", \"payload\": { \"attributes\": {";
+
+    for (size_t i = 0; i < 150; ++i) {
+        if (i) ss << ", ";
+        ss << "\"attr" << i << "\": \"value of attribute " << i << "\"";
+    }
+
+    ss << " }, \"history\": [";
+    for (size_t i = 0; i < 50; ++i) ss << (i ? ", " : " ") << i * 1000;
+
+    ss << " ] } }";
+    return ss.str();
+}
+
+// Modifies two fields and forwards the rest.
+template<typename T>
+void roundTrip(const std::string& input, std::string& output)
+{
+    Record<T> record;
+    json::parse(input, record);
+
+    record.id++;
+    record.name = "forwarded";
+
+    std::stringstream ss;
+    json::print(ss, record);
+    output = ss.str();
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 100 * 1000);
+
+    std::string input = makeRecord();
+    std::printf("record: %zu bytes\n", input.size());
+
+    std::string output;
+
+    bench::run("roundtrip.parsed", n, [&] {
+                roundTrip<Payload>(input, output);
+                bench::sink(output);
+            });
+
+    bench::run("roundtrip.raw", n, [&] {
+                roundTrip<json::Raw>(input, output);
+                bench::sink(output);
+            });
+
+    bench::run("roundtrip.lazy", n, [&] {
+                roundTrip< json::Lazy<Payload> >(input, output);
+                bench::sink(output);
+            });
+}
@@ -0,0 +1,127 @@
+/* reader_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Raw tokenizer throughput over a large document read either from memory,
+   with each of the scanning kernels, or through a stream. Also measures
+   skipping the document as a whole which doesn't tokenize it, validating it
+   and checking its UTF-8 on its own.
+*/
+
+#include "reflect.h"
+#include "utils/json.h"
+#include "bench.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* DOCUMENT                                                                   */
+/******************************************************************************/
+
+std::string makeDocument(size_t records)
+{
+    std::stringstream ss;
+    ss << "[\n";
+
+    for (size_t i = 0; i < records; ++i) {
+        if (i) ss << ",\n";
+        ss  << "    { \"id\": " << i
+            << ", \"name\": \"record number " << i << " with some padding\""
+            << ", \"price\": " << i << ".25"
+            << ", \"tags\": [ \"red\", \"green\", \"blue\" ]"
+            << ", \"active\": " << (i % 2 ? "true" : "false")
+            << ", \"next\": null }";
+    }
+
+    ss << "\n]\n";
+    return ss.str();
+}
+
+// Long strings and deep indentation which is where the scanning kernels pay off.
+std::string makeTextDocument(size_t records)
+{
+    std::string text;
+    for (size_t i = 0; i < 8; ++i)
+        text += "the quick brown fox jumps over the lazy dog ";
+
+    std::stringstream ss;
+    ss << "[\n";
+
+    for (size_t i = 0; i < records; ++i) {
+        if (i) ss << ",\n";
+        ss << std::string(24, ' ') << "\"" << text << i << "\"";
+    }
+
+    ss << "\n]\n";
+    return ss.str();
+}
+
+size_t tokenize(json::Reader& reader)
+{
+    size_t tokens = 0;
+    while (reader.nextToken().type() != json::Token::EOS) tokens++;
+    return tokens;
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 10);
+
+    std::string doc = makeDocument(100 * 1000);
+    std::string text = makeTextDocument(100 * 1000);
+    std::printf("document: %zu bytes, text: %zu bytes\n", doc.size(), text.size());
+
+    const char* names[] = { "scalar", "sse2", "avx2" };
+    auto isas = { json::ScanIsa::Scalar, json::ScanIsa::Sse2, json::ScanIsa::Avx2 };
+
+    for (json::ScanIsa isa : isas) {
+        if (!json::scanSupported(isa)) continue;
+        json::scanIsa(isa);
+
+        std::string name = names[unsigned(isa)];
+
+        bench::run("tokenize.buffer." + name, n, [&] {
+                    json::Reader reader(doc);
+                    bench::sink(tokenize(reader));
+                });
+
+        bench::run("tokenize.text." + name, n, [&] {
+                    json::Reader reader(text);
+                    bench::sink(tokenize(reader));
+                });
+
+        bench::run("skip.buffer." + name, n, [&] {
+                    json::Reader reader(doc);
+                    json::skip(reader);
+                    bench::sink(reader.offset());
+                });
+
+        bench::run("validate.buffer." + name, n, [&] {
+                    bench::sink(json::validate(doc));
+                });
+
+        bench::run("utf8.text." + name, n, [&] {
+                    const char* end = text.data() + text.size();
+                    bench::sink(json::details::validateUtf8(text.data(), end));
+                });
+    }
+
+    bench::run("tokenize.stream", n, [&] {
+                std::istringstream stream(doc);
+                json::Reader reader(stream);
+                bench::sink(tokenize(reader));
+            });
+
+    bench::run("skip.stream", n, [&] {
+                std::istringstream stream(doc);
+                json::Reader reader(stream);
+                json::skip(reader);
+                bench::sink(reader.offset());
+            });
+}
@@ -0,0 +1,77 @@
+/* records.h                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Flat records shared by the json benchmarks.
+
+   The reflection of the record is implemented here so the header can only be
+   included by the single source file of a benchmark.
+*/
+
+#pragma once
+
+#include "reflect.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+/******************************************************************************/
+/* RECORD                                                                     */
+/******************************************************************************/
+
+struct Record
+{
+    int64_t id;
+    double price;
+    std::string name;
+    std::vector<int64_t> tags;
+    bool active;
+};
+
+reflectStaticFields(Record, id, price, name, tags, active)
+
+reflectType(Record)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+}
+
+
+/******************************************************************************/
+/* GENERATORS                                                                 */
+/******************************************************************************/
+
+inline std::vector<Record> makeRecords(size_t n)
+{
+    std::vector<Record> records(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        records[i].id = i;
+        records[i].price = i + 0.25;
+        records[i].name = "record number " + std::to_string(i);
+        records[i].tags = { int64_t(i), int64_t(i + 1), int64_t(i + 2) };
+        records[i].active = i % 2;
+    }
+
+    return records;
+}
+
+// The json of the i-th record of makeRecords on a single line.
+inline std::string recordJson(size_t i)
+{
+    std::stringstream ss;
+    ss  << "{ \"id\": " << i
+        << ", \"price\": " << i << ".25"
+        << ", \"name\": \"record number " << i << "\""
+        << ", \"tags\": [ " << i << ", " << i + 1 << ", " << i + 2 << " ]"
+        << ", \"active\": " << (i % 2 ? "true" : "false")
+        << " }";
+    return ss.str();
+}
@@ -0,0 +1,81 @@
+/* try_bench.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Compares the cost of failed lookups through the throwing and the try*
+   interfaces. Misses are the common case when probing types speculatively.
+
+   Function and field lookups are raised from the library which isn't compiled
+   with exceptions so those are compared against the has* then get idiom.
+*/
+
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "reflect.h"
+#include "types/std/string.h"
+#include "bench.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+template<typename Fn>
+void throws(Fn&& fn)
+{
+    try { fn(); }
+    catch (const Error&) {}
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    size_t n = bench::iterations(argc, argv, 100000);
+
+    int i = 10;
+    Value value(i);
+    std::string str("bob");
+
+    bench::run("cast.miss.throw", n, [&] {
+                throws([&] { bench::sink(value.cast<std::string>()); });
+            });
+    bench::run("cast.miss.try", n, [&] {
+                bench::sink(value.tryCast<std::string>());
+            });
+    bench::run("cast.hit.try", n, [&] {
+                bench::sink(value.tryCast<int>());
+            });
+
+    bench::run("call.noOverload.throw", n, [&] {
+                throws([&] { value.call<void>("operator=", str); });
+            });
+    bench::run("call.noOverload.try", n, [&] {
+                bench::sink(value.tryCall<void>("operator=", str));
+            });
+    bench::run("call.noFunction.has", n, [&] {
+                if (value.type()->hasFunction("bob")) value.call<void>("bob");
+            });
+    bench::run("call.noFunction.try", n, [&] {
+                bench::sink(value.tryCall<void>("bob"));
+            });
+    bench::run("call.hit.try", n, [&] {
+                bench::sink(value.tryCall<void>("operator=", 10));
+            });
+
+    bench::run("field.miss.has", n, [&] {
+                if (value.type()->hasField("bob")) bench::sink(value.field("bob"));
+            });
+    bench::run("field.miss.try", n, [&] {
+                bench::sink(value.tryField("bob"));
+            });
+
+    bench::run("miss.what", n, [&] {
+                bench::sink(value.tryCall<void>("operator=", str).what());
+            });
+}
@@ -325,6 +325,47 @@ BOOST_AUTO_TEST_CASE(uniquePtr)
 }
 
 
+/******************************************************************************/
+/* POINTEE                                                                    */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(pointee)
+{
+    typedef test::Object Obj;
+    Obj obj(10);
+
+    BOOST_CHECK_EQUAL(type<Obj*>()->pointerKind(), PointerKind::Raw);
+    BOOST_CHECK_EQUAL(
+            type< std::shared_ptr<Obj> >()->pointerKind(), PointerKind::Shared);
+    BOOST_CHECK_EQUAL(
+            type< std::unique_ptr<Obj> >()->pointerKind(), PointerKind::Unique);
+    BOOST_CHECK_EQUAL(type<Obj>()->pointerKind(), PointerKind::None);
+
+    Obj* ptr = &obj;
+    Value vPtr(ptr);
+    BOOST_CHECK_EQUAL(&vPtr.pointee().get<Obj>(), &obj);
+    BOOST_CHECK_EQUAL(vPtr.pointee().type(), type<Obj>());
+
+    const Value cPtr(static_cast<Obj* const&>(ptr));
+    BOOST_CHECK(cPtr.pointee().isConst());
+
+    ptr = nullptr;
+    BOOST_CHECK(vPtr.pointee().isVoid());
+
+    std::shared_ptr<Obj> shared = std::make_shared<Obj>(20);
+    Value vShared(shared);
+    BOOST_CHECK_EQUAL(&vShared.pointee().get<Obj>(), shared.get());
+    BOOST_CHECK(!vShared.pointee().isConst());
+
+    shared.reset();
+    BOOST_CHECK(vShared.pointee().isVoid());
+
+    std::unique_ptr<Obj> unique(new Obj(30));
+    Value vUnique(unique);
+    BOOST_CHECK_EQUAL(vUnique.pointee().field<int>("value"), 30);
+}
+
+
 /******************************************************************************/
 /* TODO                                                                       */
 /******************************************************************************/
@@ -0,0 +1,198 @@
+/* static_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the compile-time reflection.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "reflect.h"
+#include "types/primitives.h"
+#include "types/std/string.h"
+#include "dsl/all.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* TYPES                                                                      */
+/******************************************************************************/
+
+namespace test {
+
+struct Base
+{
+    int id;
+};
+
+struct Point : public Base
+{
+    Point() : x(0), y(0) {}
+    Point(int id_, int x, int y, std::string name) :
+        x(x), y(y), name(std::move(name))
+    {
+        id = id_;
+    }
+
+    int x;
+    int y;
+    std::string name;
+
+    int sum() const { return x + y; }
+    void scale(int factor) { x *= factor; y *= factor; }
+};
+
+template<typename T>
+struct Pair
+{
+    T first;
+    T second;
+};
+
+} // namespace test
+
+reflectStaticTrait(key)
+reflectStaticTrait(hidden)
+
+reflectStaticFields(test::Base, id)
+reflectStaticFieldTraits(test::Base, id, key)
+
+reflectStaticParent(test::Point, test::Base)
+reflectStaticFields(test::Point, x, y, name)
+reflectStaticMethods(test::Point, sum, scale)
+reflectStaticFieldTraits(test::Point, name, key, hidden)
+
+reflectType(test::Base) { reflectStatic(); }
+reflectType(test::Point) { reflectStatic(); }
+
+reflectStaticTemplateFields(test::Pair, T, first, second)
+reflectTemplate(test::Pair, T) { reflectStatic(); }
+
+
+/******************************************************************************/
+/* DESCRIPTION                                                                */
+/******************************************************************************/
+
+struct Names
+{
+    std::vector<std::string> names;
+
+    template<typename Field>
+    void operator() (Field) { names.push_back(Field::name()); }
+};
+
+BOOST_AUTO_TEST_CASE(description)
+{
+    BOOST_CHECK( StaticFields<test::Point>::reflected);
+    BOOST_CHECK(!StaticFields<int>::reflected);
+    BOOST_CHECK((std::is_same<StaticParent<test::Point>::type, test::Base>::value));
+
+    auto fields = forEachField<test::Point>(Names()).names;
+    std::vector<std::string> expected = { "id", "x", "y", "name" };
+    BOOST_CHECK(fields == expected);
+
+    auto methods = forEachMethod<test::Point>(Names()).names;
+    expected = { "sum", "scale" };
+    BOOST_CHECK(methods == expected);
+}
+
+BOOST_AUTO_TEST_CASE(templates)
+{
+    BOOST_CHECK(StaticFields< test::Pair<int> >::reflected);
+    BOOST_CHECK(StaticFields< test::Pair<std::string> >::reflected);
+
+    auto fields = forEachField< test::Pair<std::string> >(Names()).names;
+    std::vector<std::string> expected = { "first", "second" };
+    BOOST_CHECK(fields == expected);
+
+    test::Pair<int> pair = { 1, 2 };
+    Value value(pair);
+    BOOST_CHECK_EQUAL(value.field<int>("second"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(members)
+{
+    test::Point p(1, 2, 3, "bob");
+
+    typedef StaticFields<test::Point> Fields;
+    typedef StaticField<test::Point, int, &test::Point::y, Fields::name_y> Y;
+
+    BOOST_CHECK_EQUAL(Y::get(p), 3);
+    Y::get(p) = 10;
+    BOOST_CHECK_EQUAL(p.y, 10);
+    BOOST_CHECK_EQUAL(Y::offset(), offsetof(test::Point, y));
+
+    typedef StaticMethods<test::Point> Methods;
+    typedef StaticMethod<test::Point,
+            decltype(&test::Point::scale), &test::Point::scale,
+            Methods::name_scale> Scale;
+
+    Scale::call(p, 2);
+    BOOST_CHECK_EQUAL(p.x, 4);
+    BOOST_CHECK_EQUAL(p.y, 20);
+}
+
+BOOST_AUTO_TEST_CASE(traits)
+{
+    typedef StaticFields<test::Point> Fields;
+    typedef StaticField<test::Point, std::string, &test::Point::name,
+            Fields::name_name> NameField;
+    typedef StaticField<test::Point, int, &test::Point::x,
+            Fields::name_x> X;
+
+    BOOST_CHECK((HasStaticTrait<NameField, tags::key>::value));
+    BOOST_CHECK((HasStaticTrait<NameField, tags::hidden>::value));
+    BOOST_CHECK((!HasStaticTrait<X, tags::key>::value));
+}
+
+
+/******************************************************************************/
+/* ALGORITHMS                                                                 */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(algorithms)
+{
+    test::Point a(1, 2, 3, "bob");
+    test::Point b(1, 2, 3, "bob");
+    test::Point c(2, 2, 3, "bob");
+
+    BOOST_CHECK( staticEqual(a, b));
+    BOOST_CHECK(!staticEqual(a, c));
+    BOOST_CHECK_EQUAL(staticHash(a), staticHash(b));
+    BOOST_CHECK_NE(staticHash(a), staticHash(c));
+}
+
+
+/******************************************************************************/
+/* RUNTIME                                                                    */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(runtime)
+{
+    const Type* tPoint = type<test::Point>();
+
+    BOOST_CHECK(tPoint->isChildOf<test::Base>());
+    BOOST_CHECK(tPoint->hasField("id"));
+    BOOST_CHECK(tPoint->hasField("x"));
+    BOOST_CHECK(tPoint->hasField("name"));
+    BOOST_CHECK(tPoint->field("name").is("key"));
+    BOOST_CHECK(tPoint->field("name").is("hidden"));
+    BOOST_CHECK(!tPoint->field("x").is("key"));
+    BOOST_CHECK(tPoint->field("id").is("key"));
+
+    test::Point p(1, 2, 3, "bob");
+    Value value(p);
+
+    BOOST_CHECK_EQUAL(value.field<int>("y"), 3);
+    BOOST_CHECK_EQUAL(value.field<int>("id"), 1);
+    BOOST_CHECK_EQUAL(value.field<std::string>("name"), "bob");
+    BOOST_CHECK_EQUAL(value.call<int>("sum"), 5);
+
+    value.call<void>("scale", 2);
+    BOOST_CHECK_EQUAL(p.x, 4);
+}
@@ -208,7 +208,7 @@ struct Convertible
         Parent p;
         p.value = value;
         p.shadowed = value.value;
-        return std::move(p);
+        return p;
     }
 
     bool operator== (const Convertible& other) const
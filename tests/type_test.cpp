@@ -19,6 +19,7 @@ using namespace reflect;
 BOOST_AUTO_TEST_CASE(void_)
 {
     const Type* t = type<void>();
+    BOOST_CHECK_EQUAL(t->kind(), TypeKind::Void);
 
     BOOST_CHECK(!t->parent());
     BOOST_CHECK(t->isParentOf<void>());
@@ -78,6 +79,14 @@ BOOST_AUTO_TEST_CASE(function_)
     const Type* tConvertible = type<test::Convertible>();
     BOOST_CHECK( tConvertible->hasFunction("operator int()"));
     BOOST_CHECK( tConvertible->hasFunction("operator test::Parent()"));
+
+    BOOST_CHECK( tObject->hasFunction(Operator::PlusAssign));
+    BOOST_CHECK( tObject->hasFunction(Operator::Inc));
+    BOOST_CHECK(!tObject->hasFunction(Operator::MinusAssign));
+    BOOST_CHECK_EQUAL(
+            &tObject->function(Operator::Assign),
+            &tObject->function("operator="));
+    BOOST_CHECK( tChild->hasFunction(Operator::Assign));
 }
 
 BOOST_AUTO_TEST_CASE(field)
@@ -209,3 +218,45 @@ BOOST_AUTO_TEST_CASE(converter)
     BOOST_CHECK( tConvertible->hasConverter<test::Parent>());
     BOOST_CHECK(!tConvertible->hasConverter<test::Convertible>());
 }
+
+BOOST_AUTO_TEST_CASE(tryLookup)
+{
+    const Type* tChild = type<test::Child>();
+
+    BOOST_CHECK(tChild->tryFunction("normalVirtual"));
+    BOOST_CHECK(tChild->tryFunction("test::Parent"));
+    BOOST_CHECK_EQUAL(
+            tChild->tryFunction("bob").status(), Status::NoFunction);
+
+    BOOST_CHECK(tChild->tryField("childValue"));
+    BOOST_CHECK_EQUAL(
+            &tChild->tryField("value").value(),
+            &type<test::Parent>()->field("value"));
+    BOOST_CHECK_EQUAL(tChild->tryField("bob").status(), Status::NoField);
+
+    BOOST_CHECK_EQUAL(
+            type<int>()->tryCall<int>("int", test::Parent()).status(),
+            Status::NoOverload);
+    BOOST_CHECK_EQUAL(type<int>()->tryCall<int>("int", 10).value(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(cache)
+{
+    // Slots are never handed back so these two are gone for the rest of the
+    // process. That's fine here: the test runs in its own binary which doesn't
+    // link the json library, the only other user of the slots, and no other
+    // test of this file allocates any.
+    size_t a = Type::cacheSlot();
+    size_t b = Type::cacheSlot();
+    BOOST_CHECK_NE(a, b);
+
+    const Type* tInt = type<int>();
+    const Type* tObject = type<test::Object>();
+    BOOST_CHECK(!tInt->cache(a));
+
+    int value = 10;
+    tInt->cache(a, &value);
+    BOOST_CHECK_EQUAL(tInt->cache(a), &value);
+    BOOST_CHECK(!tInt->cache(b));
+    BOOST_CHECK(!tObject->cache(a));
+}
@@ -0,0 +1,120 @@
+/* arena_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the parsing of pointer graphs into an arena.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "types/std/smart_ptr.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+typedef boost::mpl::list<
+    StaticBox< std::shared_ptr<Record> >,
+    DynamicBox< std::shared_ptr<Entry> >
+    > Boxes;
+
+// The static codec skips the next field which Record doesn't have.
+const std::string Graph =
+    "{ \"value\": { \"id\": 1, \"name\": \"a\", \"next\": { \"id\": 4 } },"
+    "  \"values\": [ { \"id\": 2 }, null, { \"id\": 3 } ] }";
+
+// An arena whose current block holds every allocation of the test.
+struct Blocks
+{
+    Blocks() : arena(1024 * 1024), first(arena.allocate(1, 1)) {}
+
+    bool owns(const void* ptr) const
+    {
+        const char* base = static_cast<const char*>(first);
+        return ptr >= base && ptr < base + arena.capacity();
+    }
+
+    Arena arena;
+    void* first;
+};
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_graph, Box, Boxes)
+{
+    Blocks blocks;
+
+    {
+        Box box;
+        BOOST_REQUIRE(!parse(Graph, box, blocks.arena));
+
+        BOOST_REQUIRE(box.value);
+        BOOST_CHECK_EQUAL(box.value->name, "a");
+        BOOST_CHECK(blocks.owns(box.value.get()));
+
+        BOOST_REQUIRE_EQUAL(box.values.size(), 3u);
+        BOOST_CHECK(!box.values[1]);
+        BOOST_CHECK_EQUAL(box.values[2]->id, 3);
+        BOOST_CHECK(blocks.owns(box.values[0].get()));
+        BOOST_CHECK(blocks.owns(box.values[2].get()));
+    }
+
+    blocks.arena.release();
+
+    // Without an arena the pointees come from the heap.
+    Box heap;
+    BOOST_REQUIRE(!parse(Graph, heap));
+    BOOST_CHECK(!blocks.owns(heap.value.get()));
+    BOOST_CHECK_EQUAL(heap.values[2]->id, 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_nested)
+{
+    Blocks blocks;
+
+    {
+        DynamicBox< std::shared_ptr<Entry> > box;
+        BOOST_REQUIRE(!parse(Graph, box, blocks.arena));
+
+        BOOST_REQUIRE(box.value->next);
+        BOOST_CHECK_EQUAL(box.value->next->id, 4);
+        BOOST_CHECK(blocks.owns(box.value->next.get()));
+    }
+
+    blocks.arena.release();
+}
+
+BOOST_AUTO_TEST_CASE(test_existing)
+{
+    // Existing pointees are parsed into and not moved to the arena. The
+    // arena must outlive the pointees that it holds.
+    Blocks blocks;
+
+    DynamicBox< std::shared_ptr<Entry> > box;
+    box.value = std::make_shared<Entry>();
+    Entry* entry = box.value.get();
+
+    BOOST_REQUIRE(!parse(Graph, box, blocks.arena));
+    BOOST_CHECK_EQUAL(box.value.get(), entry);
+    BOOST_CHECK_EQUAL(entry->id, 1);
+    BOOST_CHECK(blocks.owns(entry->next.get()));
+    BOOST_CHECK(blocks.owns(box.values[0].get()));
+}
@@ -0,0 +1,164 @@
+/* document_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the tape based json document.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+Document parseDocument(const std::string& str)
+{
+    Document doc;
+    auto err = parse(str, doc);
+    if (err) reflectError("unable to parse document: %s", err.what());
+    return doc;
+}
+
+struct Holder
+{
+    int64_t id;
+    Document doc;
+};
+
+reflectType(Holder)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(id);
+    reflectField(doc);
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_generic)
+{
+    Document doc = parseDocument(readFile("generic.json"));
+    Node root = doc.root();
+
+    BOOST_CHECK(root.is(Node::Object));
+    BOOST_CHECK_EQUAL(root.size(), 7u);
+
+    BOOST_CHECK(root.at("null").isNull());
+    BOOST_CHECK_EQUAL(root.at("bool").asBool(), true);
+    BOOST_CHECK_EQUAL(root.at("int").asInt(), 123);
+    BOOST_CHECK_EQUAL(root.at("int").asFloat(), 123.0);
+    BOOST_CHECK_EQUAL(root.at("float").asFloat(), 123.321);
+    BOOST_CHECK_EQUAL(root.at("string").asString(), "abc");
+    BOOST_CHECK(!root.find("missing").valid());
+
+    Node array = root.at("array");
+    BOOST_CHECK_EQUAL(array.size(), 3u);
+    BOOST_CHECK_EQUAL(array.at(0).asInt(), 1);
+    BOOST_CHECK_EQUAL(array.at(1).at(0).asInt(), 2);
+    BOOST_CHECK_EQUAL(array.at(2).at("3").asInt(), 4);
+
+    Node obj = root.at("object");
+    BOOST_CHECK_EQUAL(obj.at("c").at("3").asInt(), 4);
+
+    std::vector<std::string> keys;
+    for (auto it = root.begin(), end = root.end(); it != end; ++it)
+        keys.push_back(it.key().str());
+
+    std::vector<std::string> exp =
+        { "null", "bool", "int", "float", "string", "array", "object" };
+    BOOST_CHECK(keys == exp);
+
+    BOOST_CHECK(root.at("string").is(Node::String));
+    BOOST_CHECK(!root.at("string").is(Node::Int));
+    BOOST_CHECK(!Node().is(Node::Null));
+}
+
+BOOST_AUTO_TEST_CASE(test_large_object)
+{
+    std::string json = "{";
+    for (size_t i = 0; i < 100; ++i)
+        json += "\"key" + std::to_string(i) + "\": " + std::to_string(i) + ", ";
+    json += "\"key5\": -1 }";
+
+    Document doc = parseDocument(json);
+    Node root = doc.root();
+    BOOST_CHECK_GT(root.size(), size_t(Node::LinearFields));
+
+    for (size_t i = 0; i < 100; ++i)
+        BOOST_CHECK_EQUAL(root.at("key" + std::to_string(i)).asInt(), int64_t(i));
+
+    BOOST_CHECK(!root.find("key100").valid());
+
+    // Copies don't share the index of the original.
+    Document copy = doc;
+    BOOST_CHECK_EQUAL(copy.root().at("key42").asInt(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(test_value)
+{
+    Document doc = parseDocument(readFile("generic.json"));
+    Value value = doc.root().value();
+
+    BOOST_CHECK(value.is("map"));
+    BOOST_CHECK_EQUAL(value.type()->getValue<const Type*>("valueType"), type<Value>());
+
+    Value array = value.call<Value>("at", std::string("array"));
+    BOOST_CHECK(array.is("list"));
+    BOOST_CHECK_EQUAL(array.call<size_t>("size"), 3u);
+    BOOST_CHECK_EQUAL(array.call<Value>("at", size_t(0)).cast<int64_t>(), 1);
+
+    Value str = value.call<Value>("at", std::string("string"));
+    BOOST_CHECK_EQUAL(str.cast<std::string>(), "abc");
+}
+
+BOOST_AUTO_TEST_CASE(test_print)
+{
+    Document doc = parseDocument(readFile("generic.json"));
+    std::string json = print(doc).first;
+
+    Document other = parseDocument(json);
+    BOOST_CHECK_EQUAL(print(other).first, json);
+    BOOST_CHECK_EQUAL(other.root().at("object").at("b").at(0).asInt(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_dynamic)
+{
+    Holder holder;
+    std::string json = "{ \"id\": 10, \"doc\": { \"a\": [ 1, \"b\", null ] } }";
+    BOOST_CHECK(!parse(json, holder));
+
+    BOOST_CHECK_EQUAL(holder.id, 10);
+    Node a = holder.doc.root().at("a");
+    BOOST_CHECK_EQUAL(a.size(), 3u);
+    BOOST_CHECK_EQUAL(a.at(1).asString(), "b");
+    BOOST_CHECK(a.at(2).isNull());
+}
+
+BOOST_AUTO_TEST_CASE(test_errors)
+{
+    Document doc = parseDocument("[ 1, 2 ]");
+    BOOST_CHECK(!doc.empty());
+
+    std::string bad = "{ \"a\": [ 1, 2 } }";
+    BOOST_CHECK(parse(bad, doc));
+    BOOST_CHECK(doc.empty());
+    BOOST_CHECK(!doc.root().valid());
+}
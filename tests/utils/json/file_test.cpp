@@ -0,0 +1,160 @@
+/* file_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the parsing and printing of json files.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+#include <fstream>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+// Removes the file when it goes out of scope.
+struct TempFile
+{
+    TempFile()
+    {
+        char name[] = "/tmp/reflect_file_test_XXXXXX";
+        int fd = mkstemp(name);
+        if (fd < 0) reflectError("unable to create temp file");
+        ::close(fd);
+        path = name;
+    }
+
+    ~TempFile() { std::remove(path.c_str()); }
+
+    void write(const std::string& data) const
+    {
+        std::ofstream stream(path);
+        stream << data;
+    }
+
+    std::string read() const
+    {
+        std::ifstream stream(path);
+        return std::string(
+                std::istreambuf_iterator<char>(stream),
+                std::istreambuf_iterator<char>());
+    }
+
+    std::string path;
+};
+
+std::vector<Entry> makeEntries(size_t n)
+{
+    std::vector<Entry> records(n);
+    for (size_t i = 0; i < n; ++i) {
+        records[i].id = i;
+        records[i].name = "record \"" + std::to_string(i) + "\" \xC3\xA9";
+        records[i].tags = { int64_t(i), int64_t(i * 2) };
+    }
+    return records;
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_round_trip)
+{
+    TempFile file;
+
+    // Large enough to go through several blocks of the writer.
+    std::vector<Entry> exp = makeEntries(100 * 1000);
+    BOOST_CHECK(!printFile(file.path, exp));
+    BOOST_CHECK_GT(file.read().size(), size_t(Writer::BlockSize));
+    BOOST_CHECK_EQUAL(file.read(), print(exp).first);
+
+    std::vector<Entry> value;
+    BOOST_CHECK(!parseFile(file.path, value));
+    BOOST_CHECK(value == exp);
+
+    // Files are truncated before being written.
+    BOOST_CHECK(!printFile(file.path, makeEntries(1)));
+    BOOST_CHECK_EQUAL(file.read(), print(makeEntries(1)).first);
+}
+
+BOOST_AUTO_TEST_CASE(test_options)
+{
+    TempFile file;
+    std::vector<Entry> records = makeEntries(2);
+
+    auto options = Writer::Options(Writer::Pretty | Writer::ValidateUnicode);
+    BOOST_CHECK(!printFile(file.path, records, options));
+
+    std::stringstream ss;
+    {
+        Writer writer(ss, options);
+        print(writer, records);
+    }
+    BOOST_CHECK_EQUAL(file.read(), ss.str());
+
+    file.write("[ { \"id\": 1 // comment\n } ]");
+
+    std::vector<Entry> value;
+    BOOST_CHECK(parseFile(file.path, value));
+
+    value.clear();
+    BOOST_CHECK(!parseFile(file.path, value,
+                    Reader::Options(Reader::Default | Reader::AllowComments)));
+    BOOST_CHECK_EQUAL(value.at(0).id, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_errors)
+{
+    TempFile file;
+    file.write("[\n  { \"id\": 1 },\n  { \"id\": 2 ]\n]");
+
+    std::vector<Entry> value;
+    json::Error error = parseFile(file.path, value);
+    BOOST_REQUIRE(error);
+    BOOST_CHECK_EQUAL(std::string(error.what()).substr(0, 2), "3:");
+
+    file.write("");
+    BOOST_CHECK(parseFile(file.path, value));
+
+    BOOST_CHECK(parseFile("/this/does/not/exist.json", value));
+    BOOST_CHECK(printFile("/this/does/not/exist.json", value));
+}
+
+BOOST_AUTO_TEST_CASE(test_string_ref)
+{
+    TempFile file;
+    file.write("{ \"value\": \"bob\", \"values\": [ \"a\\tb\", \"c\" ] }");
+
+    // The mapping doesn't outlive the call so nothing can be borrowed from it.
+    DynamicBox<StringRef> value;
+    BOOST_CHECK(parseFile(file.path, value));
+
+    Arena arena;
+    {
+        DynamicBox<StringRef> other;
+        BOOST_REQUIRE(!parseFile(file.path, other, arena));
+        value = other;
+    }
+    BOOST_CHECK_EQUAL(value.value, "bob");
+    BOOST_REQUIRE_EQUAL(value.values.size(), 2u);
+    BOOST_CHECK_EQUAL(value.values[0], "a\tb");
+    BOOST_CHECK_EQUAL(value.values[1], "c");
+    BOOST_CHECK_GT(arena.capacity(), 0u);
+}
@@ -128,4 +128,6 @@ BOOST_AUTO_TEST_CASE(test_string)
     checkError(u({ 0xC0, 0x8F }), Writer::ValidateUnicode);
     checkError(u({ 0xE0, 0x8F }), Writer::ValidateUnicode);
     checkError(u({ 0xE0, 0x8F, 0x0F }), Writer::ValidateUnicode);
+    checkError(u({ 0xED, 0xA0, 0x80 }), Writer::ValidateUnicode);
+    checkError(u({ 0xF4, 0x90, 0x80, 0x80 }), Writer::ValidateUnicode);
 }
@@ -0,0 +1,209 @@
+/* lines_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the parallel json lines parser.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+#include <set>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+// Big enough to be split across several threads.
+std::string makeLines(size_t n)
+{
+    std::string str;
+    for (size_t i = 0; i < n; ++i) str += recordJson(i) + "\n";
+    return str;
+}
+
+void checkRecords(const std::vector<Record>& records, size_t n)
+{
+    BOOST_REQUIRE_EQUAL(records.size(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(records[i].id, int64_t(i));
+        BOOST_CHECK_EQUAL(records[i].name, recordName(i));
+        BOOST_CHECK_EQUAL(records[i].tags.size(), 2u);
+    }
+}
+
+
+/******************************************************************************/
+/* LINES                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_lines)
+{
+    const size_t n = 10 * 1000;
+    std::string input = makeLines(n);
+
+    for (size_t threads : { 1, 2, 4, 7 }) {
+        std::vector<Record> records;
+        auto errors = parseLines(input, records, threads);
+
+        BOOST_CHECK(errors.empty());
+        checkRecords(records, n);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_append)
+{
+    std::vector<Record> records(1);
+    records[0].id = 100;
+
+    std::string input = "\n  \r\n{\"id\":1}\r\n\n{\"id\":2}";
+    auto errors = parseLines(input, records);
+    BOOST_CHECK(errors.empty());
+
+    BOOST_REQUIRE_EQUAL(records.size(), 3u);
+    BOOST_CHECK_EQUAL(records[0].id, 100);
+    BOOST_CHECK_EQUAL(records[1].id, 1);
+    BOOST_CHECK_EQUAL(records[2].id, 2);
+
+    std::vector<Record> empty;
+    input.clear();
+    BOOST_CHECK(parseLines(input, empty).empty());
+    BOOST_CHECK(empty.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_dynamic)
+{
+    const size_t n = 5 * 1000;
+    std::string input = makeLines(n);
+
+    std::vector<Entry> entries;
+    auto errors = parseLines(input, entries, 4);
+
+    BOOST_CHECK(errors.empty());
+    BOOST_REQUIRE_EQUAL(entries.size(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(entries[i].id, int64_t(i));
+        BOOST_CHECK_EQUAL(entries[i].name, recordName(i));
+    }
+}
+
+
+/******************************************************************************/
+/* ERRORS                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_errors)
+{
+    const size_t n = 10 * 1000;
+
+    std::set<size_t> bad = { 1, 17, 5000, 5001, n };
+    std::string input;
+
+    for (size_t i = 1; i <= n; ++i) {
+        if (!bad.count(i)) input += recordJson(i);
+        else if (i % 2) input += "{ \"id\": " + std::to_string(i) + " ]";
+        else input += recordJson(i) + " garbage";
+        input += "\n";
+    }
+
+    for (size_t threads : { 1, 3, 8 }) {
+        std::vector<Record> records;
+        auto errors = parseLines(input, records, threads);
+
+        BOOST_CHECK_EQUAL(records.size(), n - bad.size());
+        BOOST_REQUIRE_EQUAL(errors.size(), bad.size());
+
+        auto it = bad.begin();
+        for (const auto& error : errors) {
+            BOOST_CHECK_EQUAL(error.line, *it++);
+            BOOST_CHECK(error.error);
+        }
+
+        for (size_t i = 0, line = 1; i < records.size(); ++i, ++line) {
+            while (bad.count(line)) line++;
+            BOOST_CHECK_EQUAL(records[i].id, int64_t(line));
+        }
+    }
+}
+
+
+/******************************************************************************/
+/* STREAM                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_stream)
+{
+    const size_t n = 10 * 1000;
+    std::string input = makeLines(n) + "{ \"id\": 1 ]";
+
+    std::istringstream stream(input);
+    std::vector<Record> records;
+    auto errors = parseLines(stream, records, 4);
+
+    checkRecords(records, n);
+    BOOST_REQUIRE_EQUAL(errors.size(), 1u);
+    BOOST_CHECK_EQUAL(errors[0].line, n + 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_stream_long_line)
+{
+    // Lines longer than the first block grow it until they fit.
+    std::string name(3 * LinesMinBlockSize, 'a');
+    std::string input = recordJson(0) + "\n{ \"id\": 1, \"name\": \"" + name + "\" }\n";
+
+    std::istringstream stream(input);
+    std::vector<Record> records;
+    auto errors = parseLines(stream, records);
+
+    BOOST_CHECK(errors.empty());
+    BOOST_REQUIRE_EQUAL(records.size(), 2u);
+    BOOST_CHECK_EQUAL(records[1].name, name);
+}
+
+BOOST_AUTO_TEST_CASE(test_stream_string_ref)
+{
+    typedef StaticBox<StringRef> Box;
+
+    const size_t n = 20 * 1000;
+    std::string input;
+    for (size_t i = 0; i < n; ++i) {
+        input += "{ \"id\": " + std::to_string(i) + ", \"value\": \"n" + std::to_string(i);
+        input += "\", \"values\": [ \"a\\tb\" ] }\n";
+    }
+    BOOST_REQUIRE_GT(input.size(), size_t(LinesMinBlockSize));
+
+    // The blocks are gone once the call returns so everything is copied.
+    Arena arena;
+    std::vector<Box> boxes;
+    {
+        std::istringstream stream(input);
+        BOOST_CHECK(parseLines(stream, boxes, arena, 4).empty());
+    }
+
+    BOOST_REQUIRE_EQUAL(boxes.size(), n);
+    for (size_t i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(boxes[i].id, int64_t(i));
+        BOOST_CHECK_EQUAL(boxes[i].value, "n" + std::to_string(i));
+        BOOST_CHECK_EQUAL(boxes[i].values[0], "a\tb");
+    }
+
+    // Which needs an arena.
+    std::istringstream stream(input);
+    std::vector<Box> none;
+    BOOST_CHECK_EQUAL(parseLines(stream, none).size(), n);
+    BOOST_CHECK(none.empty());
+}
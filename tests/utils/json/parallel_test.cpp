@@ -0,0 +1,121 @@
+/* parallel_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the parallel parsing of top-level arrays which must produce the
+   exact same results as the sequential parser.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+std::string makeArray(size_t n, size_t bad = -1)
+{
+    std::string str = "\n [";
+
+    for (size_t i = 0; i < n; ++i) {
+        if (i) str += ",\n  ";
+        str += i == bad ? "{ \"id\": 1 ]" : recordJson(i);
+    }
+
+    return str + "\n]\n";
+}
+
+// Enough elements to go over ParallelMinSize.
+const size_t Elements = 30 * 1000;
+
+template<typename T>
+json::Error parseWith(size_t threads, const std::string& str, std::vector<T>& value)
+{
+    ParallelThreads guard(threads);
+    return json::parse(str, value);
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_static)
+{
+    std::string json = makeArray(Elements);
+    BOOST_REQUIRE_GT(json.size(), size_t(ParallelMinSize));
+
+    std::vector<Record> exp;
+    BOOST_REQUIRE(!parseWith(1, json, exp));
+    BOOST_REQUIRE_EQUAL(exp.size(), Elements);
+    BOOST_CHECK_EQUAL(exp[10].name, recordName(10));
+
+    for (size_t threads : { 2, 3, 8 }) {
+        std::vector<Record> value;
+        BOOST_CHECK(!parseWith(threads, json, value));
+        BOOST_CHECK(value == exp);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_dynamic)
+{
+    std::string json = makeArray(Elements);
+
+    std::vector<Entry> value;
+    BOOST_CHECK(!parseWith(4, json, value));
+    BOOST_REQUIRE_EQUAL(value.size(), Elements);
+
+    for (size_t i = 0; i < Elements; ++i) {
+        BOOST_CHECK_EQUAL(value[i].id, int64_t(i));
+        BOOST_CHECK_EQUAL(value[i].tags.size(), 2u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_append)
+{
+    std::string json = makeArray(Elements);
+
+    std::vector<Record> value(2);
+    BOOST_CHECK(!parseWith(4, json, value));
+
+    BOOST_REQUIRE_EQUAL(value.size(), Elements + 2);
+    BOOST_CHECK_EQUAL(value[1].id, 0);
+    BOOST_CHECK_EQUAL(value[3].id, 1);
+    BOOST_CHECK_EQUAL(value.back().id, int64_t(Elements - 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_errors)
+{
+    for (size_t bad : { size_t(0), Elements / 2 + 1, Elements - 1 }) {
+        std::string json = makeArray(Elements, bad);
+
+        std::vector<Record> exp;
+        json::Error expError = parseWith(1, json, exp);
+        BOOST_REQUIRE(expError);
+
+        std::vector<Record> value;
+        json::Error error = parseWith(4, json, value);
+        BOOST_CHECK(error);
+        BOOST_CHECK_EQUAL(error.what(), expError.what());
+    }
+
+    // Not closed so the index gives up and the sequential parser reports it.
+    std::string json = makeArray(Elements);
+    json.resize(json.size() - 3);
+
+    std::vector<Record> value;
+    BOOST_CHECK(parseWith(4, json, value));
+}
@@ -0,0 +1,186 @@
+/* projection_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the parsing of a subset of the fields of a document.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "types/std/smart_ptr.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* TYPES                                                                      */
+/******************************************************************************/
+
+struct Inner
+{
+    Inner() : a(0) {}
+
+    int64_t a;
+    std::string b;
+    std::vector<int64_t> c;
+};
+
+reflectType(Inner)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(a);
+    reflectField(b);
+    reflectField(c);
+}
+
+struct Outer
+{
+    Outer() : id(0), renamed(0) {}
+
+    int64_t id;
+    std::string name;
+    Inner inner;
+    std::shared_ptr<Inner> ptr;
+    std::map<std::string, Inner> map;
+    int64_t renamed;
+};
+
+reflectType(Outer)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(id);
+    reflectField(name);
+    reflectField(inner);
+    reflectField(ptr);
+    reflectField(map);
+    reflectField(renamed);
+    reflectFieldValue(renamed, json, json::alias("bob"));
+}
+
+const std::string Doc =
+    "{ \"id\": 10, \"name\": \"bob\","
+    "  \"inner\": { \"a\": 1, \"b\": \"x\", \"c\": [ 1, 2 ] },"
+    "  \"unknown\": [ { \"a\": 1 }, \"]}\" ],"
+    "  \"ptr\": { \"a\": 2, \"b\": \"y\" },"
+    "  \"map\": { \"k\": { \"a\": 3 }, \"a/b~c\": { \"a\": 4 }, \"l\": { \"a\": 5 } },"
+    "  \"bob\": 20 }";
+
+Projection project(const std::vector<std::string>& paths,
+        Projection::Options options = Projection::None)
+{
+    return Projection(type<Outer>(), paths, options);
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_paths)
+{
+    Projection projection = project(
+            { "id", "inner.b", "/ptr/a", "map.k.a", "/map/a~1b~0c/a", "bob" });
+    BOOST_CHECK_EQUAL(projection.size(), 6u);
+
+    Outer value;
+    BOOST_CHECK(!parse(Doc, value, projection));
+
+    BOOST_CHECK_EQUAL(value.id, 10);
+    BOOST_CHECK_EQUAL(value.renamed, 20);
+    BOOST_CHECK_EQUAL(value.inner.b, "x");
+    BOOST_REQUIRE(value.ptr);
+    BOOST_CHECK_EQUAL(value.ptr->a, 2);
+    BOOST_CHECK_EQUAL(value.map["k"].a, 3);
+    BOOST_CHECK_EQUAL(value.map["a/b~c"].a, 4);
+
+    // Everything else is left untouched.
+    BOOST_CHECK_EQUAL(value.name, "");
+    BOOST_CHECK_EQUAL(value.inner.a, 0);
+    BOOST_CHECK(value.inner.c.empty());
+    BOOST_CHECK_EQUAL(value.ptr->b, "");
+    BOOST_CHECK_EQUAL(value.map.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(test_prefix)
+{
+    Projection projection = project({ "inner.a", "inner", "inner.c" });
+    BOOST_CHECK_EQUAL(projection.size(), 1u);
+
+    Outer value;
+    BOOST_CHECK(!parse(Doc, value, projection));
+    BOOST_CHECK_EQUAL(value.inner.a, 1);
+    BOOST_CHECK_EQUAL(value.inner.b, "x");
+    BOOST_CHECK_EQUAL(value.inner.c.size(), 2u);
+    BOOST_CHECK_EQUAL(value.id, 0);
+
+    // The empty path selects the entire document.
+    Outer all;
+    BOOST_CHECK(!parse(Doc, all, project({ "" })));
+    BOOST_CHECK_EQUAL(all.id, 10);
+    BOOST_CHECK_EQUAL(all.map.size(), 3u);
+    BOOST_CHECK_EQUAL(all.renamed, 20);
+}
+
+BOOST_AUTO_TEST_CASE(test_null)
+{
+    Outer value;
+    value.ptr = std::make_shared<Inner>();
+
+    std::string json = "{ \"ptr\": null, \"inner\": null, \"id\": 1 }";
+    BOOST_CHECK(!parse(json, value, project({ "ptr.a", "inner.a", "id" })));
+
+    BOOST_CHECK(!value.ptr);
+    BOOST_CHECK_EQUAL(value.id, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_early_stop)
+{
+    // Nothing past the last selected value is read.
+    std::string json = "{ \"name\": \"a\", \"id\": 1, \"inner\": { \"a\": ] ";
+
+    Outer value;
+    BOOST_CHECK(!parse(json, value, project({ "id", "name" })));
+    BOOST_CHECK_EQUAL(value.id, 1);
+    BOOST_CHECK_EQUAL(value.name, "a");
+
+    Outer validated;
+    auto projection = project({ "id", "name" }, Projection::Validate);
+    BOOST_CHECK(parse(json, validated, projection));
+    BOOST_CHECK_EQUAL(validated.id, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_validate)
+{
+    // Skipped values are only scanned for their boundaries unless validating.
+    std::string json = "{ \"unknown\": [ 1 2 ], \"inner\": { \"c\": [ 3 } ], \"id\": 1 }";
+
+    Outer value;
+    BOOST_CHECK(!parse(json, value, project({ "id" })));
+    BOOST_CHECK_EQUAL(value.id, 1);
+
+    Outer validated;
+    BOOST_CHECK(parse(json, validated, project({ "id" }, Projection::Validate)));
+
+    Outer valid;
+    auto projection = project({ "inner.b" }, Projection::Validate);
+    BOOST_CHECK(!parse(Doc, valid, projection));
+    BOOST_CHECK_EQUAL(valid.inner.b, "x");
+    BOOST_CHECK_EQUAL(valid.id, 0);
+
+    // No paths only validates.
+    std::string bad = "{ \"id\": ]";
+    BOOST_CHECK(parse(bad, valid, project({}, Projection::Validate)));
+}
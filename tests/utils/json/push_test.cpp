@@ -0,0 +1,197 @@
+/* push_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the resumable push parser.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+// Feeds the input in chunks of the given size and returns the number of bytes
+// consumed.
+size_t feed(PushParser& parser, const std::string& input, size_t chunk)
+{
+    size_t consumed = 0;
+
+    for (size_t i = 0; i < input.size() && !parser.done() && parser; i += chunk) {
+        // Each chunk is copied to make sure that nothing is kept around.
+        std::string data = input.substr(i, chunk);
+        consumed += parser.feed(data);
+    }
+
+    return consumed;
+}
+
+
+/******************************************************************************/
+/* CHUNKS                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_chunks)
+{
+    Basics exp;
+    Basics::construct(exp);
+
+    std::string input = readFile("value_parser.json");
+
+    for (size_t chunk : { 1, 2, 3, 7, 64, 1024 }) {
+        Basics obj;
+        PushParser parser{ Value(obj) };
+
+        size_t consumed = feed(parser, input, chunk);
+        BOOST_CHECK(parser.done());
+        BOOST_CHECK(!parser.error());
+        BOOST_CHECK_EQUAL(obj, exp);
+
+        // Only the trailing newline is left over.
+        BOOST_CHECK_EQUAL(consumed, input.size() - 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_strings)
+{
+    std::string input = "[ \"abc\", \"a\\\"b\\\\c\\u00e9\", \"\xC3\xA9t\xC3\xA9\", \"\" ]";
+    std::vector<std::string> exp = { "abc", "a\"b\\c\xC3\xA9", "\xC3\xA9t\xC3\xA9", "" };
+
+    for (size_t chunk = 1; chunk < input.size(); ++chunk) {
+        std::vector<std::string> value;
+        PushParser parser{ Value(value) };
+
+        feed(parser, input, chunk);
+        BOOST_CHECK(parser.done());
+        BOOST_CHECK(value == exp);
+    }
+}
+
+
+/******************************************************************************/
+/* STREAM                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_leftover)
+{
+    std::string input = "[1,2] [3] {\"abc\": 4}";
+
+    std::vector<int64_t> first;
+    PushParser p0{ Value(first) };
+    size_t n0 = p0.feed(input);
+    BOOST_CHECK(p0.done());
+    BOOST_CHECK_EQUAL(n0, 5);
+    BOOST_CHECK((first == std::vector<int64_t>{ 1, 2 }));
+    BOOST_CHECK_EQUAL(p0.feed(input), 0);
+
+    std::vector<int64_t> second;
+    PushParser p1{ Value(second) };
+    size_t n1 = p1.feed(input.substr(n0));
+    BOOST_CHECK(p1.done());
+    BOOST_CHECK_EQUAL(n1, 4);
+    BOOST_CHECK((second == std::vector<int64_t>{ 3 }));
+
+    std::map<std::string, int64_t> third;
+    PushParser p2{ Value(third) };
+    p2.feed(input.substr(n0 + n1));
+    BOOST_CHECK(p2.done());
+    BOOST_CHECK_EQUAL(third["abc"], 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_scalars)
+{
+    int64_t i = 0;
+    PushParser pi{ Value(i) };
+    pi.feed("12");
+    pi.feed("34");
+    BOOST_CHECK(!pi.done());
+    pi.finish();
+    BOOST_CHECK(pi.done());
+    BOOST_CHECK_EQUAL(i, 1234);
+
+    std::string s;
+    PushParser ps{ Value(s) };
+    ps.feed("\"ab");
+    ps.feed("c\"");
+    BOOST_CHECK(ps.done());
+    BOOST_CHECK_EQUAL(s, "abc");
+
+    PushParser truncated{ Value(s) };
+    truncated.feed("\"ab");
+    truncated.finish();
+    BOOST_CHECK(truncated.error());
+}
+
+
+/******************************************************************************/
+/* ERRORS                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_errors)
+{
+    auto check = [] (const std::string& input, size_t chunk) {
+        Basics obj;
+        PushParser parser{ Value(obj) };
+        feed(parser, input, chunk);
+        parser.finish();
+
+        BOOST_CHECK(parser.error());
+        return std::string(parser.error().what());
+    };
+
+    for (size_t chunk : { 1, 3, 100 }) {
+        check("{ \"integer\": 1 ", chunk);
+        check("{ \"integer\" 1 }", chunk);
+        check("{ \"vector\": [ 1 2 ] }", chunk);
+        check("{ \"custom\": \"1\" \"2\" }", chunk);
+        check("{ \"unknown\": ] }", chunk);
+        check("{ \"string\": \"abc }", chunk);
+    }
+
+    // Positions are tracked across chunks.
+    std::string err = check("{\n  \"integer\": 1,\n  \"boolean\" true\n}", 5);
+    BOOST_CHECK(err.find("3:") == 0);
+}
+
+
+/******************************************************************************/
+/* UNTYPED                                                                    */
+/******************************************************************************/
+
+std::string printValue(const Value& value)
+{
+    std::stringstream ss;
+    Writer writer(ss);
+    print(writer, value);
+    return ss.str();
+}
+
+BOOST_AUTO_TEST_CASE(test_untyped)
+{
+    std::string input = readFile("generic.json");
+
+    Value exp;
+    Reader reader(input);
+    parse(reader, exp);
+    BOOST_REQUIRE(!reader.error());
+
+    for (size_t chunk : { 1, 13, 4096 }) {
+        PushParser parser{ Value() };
+        feed(parser, input, chunk);
+        BOOST_CHECK(parser.done());
+        BOOST_CHECK_EQUAL(printValue(parser.value()), printValue(exp));
+    }
+}
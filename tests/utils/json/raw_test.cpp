@@ -0,0 +1,172 @@
+/* raw_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the passthrough of raw and lazily parsed subtrees.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+typedef boost::mpl::list< StaticBox<Raw>, DynamicBox<Raw> > RawBoxes;
+typedef boost::mpl::list< StaticBox< Lazy<Record> >, DynamicBox< Lazy<Record> > > LazyBoxes;
+
+const std::string Headers = "{ \"a\" : [1,2.50, \"\\u00e9\"],\"b\":{}}";
+const std::string First = "{\"id\": 2, \"tags\": [ 1, 2 ]}";
+const std::string Second = "{ \"name\" :\"b\" }";
+
+bool contains(const std::string& str, const std::string& part)
+{
+    return str.find(part) != std::string::npos;
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_raw, Box, RawBoxes)
+{
+    std::string json =
+        "{ \"id\": 1, \"value\":   " + Headers + " , "
+        "\"values\": [ \"a\\tb\", [ 1, [] ], 10, null, { \"c\": true } ] }";
+
+    Box box;
+    BOOST_REQUIRE(!parse(json, box));
+    BOOST_CHECK_EQUAL(box.value.json(), Headers);
+
+    // The first element of an array is peeked before being handed over.
+    BOOST_REQUIRE_EQUAL(box.values.size(), 5u);
+    BOOST_CHECK_EQUAL(box.values[0].json(), "\"a\\tb\"");
+    BOOST_CHECK_EQUAL(box.values[1].json(), "[ 1, [] ]");
+    BOOST_CHECK_EQUAL(box.values[2].json(), "10");
+    BOOST_CHECK_EQUAL(box.values[3].json(), "null");
+    BOOST_CHECK_EQUAL(box.values[4].json(), "{ \"c\": true }");
+
+    // Untouched subtrees are spliced back byte for byte.
+    box.id = 2;
+    std::string printed = print(box).first;
+    BOOST_CHECK(contains(printed, "\"value\":" + Headers));
+    BOOST_CHECK(contains(printed, "[ 1, [] ],10,null,{ \"c\": true }]"));
+    BOOST_CHECK(contains(printed, "\"id\":2"));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_lazy, Box, LazyBoxes)
+{
+    std::string json =
+        "{ \"id\": 1, \"value\":" + First + ", \"values\": [ " + Second + " ] }";
+
+    Box box;
+    BOOST_REQUIRE(!parse(json, box));
+    BOOST_CHECK_EQUAL(box.value.raw().json(), First);
+    BOOST_CHECK(!box.value.loaded());
+
+    std::string printed = print(box).first;
+    BOOST_CHECK(contains(printed, "\"value\":" + First));
+    BOOST_CHECK(contains(printed, "\"values\":[" + Second + "]"));
+
+    // Reading the lazy value doesn't change its output.
+    const Box& constant = box;
+    BOOST_CHECK_EQUAL(constant.value->id, 2);
+    BOOST_CHECK(box.value.loaded());
+    BOOST_CHECK(!box.values[0].loaded());
+    BOOST_CHECK_EQUAL(print(box).first, printed);
+
+    // Modifying it does but leaves the other values untouched.
+    box.value->tags.push_back(3);
+    printed = print(box).first;
+    BOOST_CHECK(contains(printed, "\"tags\":[1,2,3]"));
+    BOOST_CHECK(contains(printed, "\"values\":[" + Second + "]"));
+    BOOST_CHECK_EQUAL(box.values[0]->name, "b");
+}
+
+BOOST_AUTO_TEST_CASE(test_stream)
+{
+    // Captures span the blocks read from the stream.
+    std::string big = "[";
+    for (size_t i = 0; i < Reader::BlockSize / 4; ++i)
+        big += (i ? ", " : " ") + std::to_string(i);
+    big += " ]";
+
+    std::string json = "{ \"id\": 1, \"value\": " + big + ", \"values\": [ " + First + " ] }";
+
+    std::stringstream raw(json);
+    StaticBox<Raw> rawBox;
+    BOOST_REQUIRE(!parse(raw, rawBox));
+    BOOST_CHECK_EQUAL(rawBox.value.json(), big);
+    BOOST_CHECK_EQUAL(rawBox.values[0].json(), First);
+
+    json = "{ \"id\": 1, \"values\": [ " + big + " ], \"value\": [ 1 ] }";
+
+    std::stringstream lazy(json);
+    StaticBox< Lazy< std::vector<int64_t> > > lazyBox;
+    BOOST_REQUIRE(!parse(lazy, lazyBox));
+    BOOST_CHECK_EQUAL(lazyBox.values[0].raw().json(), big);
+    BOOST_CHECK_EQUAL(lazyBox.values[0]->size(), size_t(Reader::BlockSize / 4));
+    BOOST_CHECK_EQUAL(lazyBox.value->size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(test_empty)
+{
+    std::string json = "{ \"id\": 1 }";
+
+    StaticBox< Lazy<Record> > box;
+    BOOST_REQUIRE(!parse(json, box));
+    BOOST_CHECK(box.value.empty());
+    BOOST_CHECK_EQUAL(box.value->id, 0);
+    BOOST_CHECK_EQUAL(print(Raw()).first, "null");
+
+    StaticBox<Raw> raw;
+    BOOST_REQUIRE(!parse(json, raw));
+    BOOST_CHECK(raw.value.empty());
+
+    // Constructed values are printed as such.
+    Record record;
+    record.id = 3;
+    Lazy<Record> lazy(record);
+    BOOST_CHECK_EQUAL(print(lazy).first, print(record).first);
+    BOOST_CHECK(contains(print(lazy).first, "\"id\":3"));
+
+    // Copies don't point into the source.
+    json = "{ \"value\": { \"name\": \"a\" } }";
+    StaticBox< Lazy<Record> > source;
+    BOOST_REQUIRE(!parse(json, source));
+    BOOST_CHECK_EQUAL(source.value->name, "a");
+
+    std::unique_ptr< Lazy<Record> > copy(new Lazy<Record>(source.value));
+    Lazy<Record> moved(std::move(*copy));
+    copy.reset();
+    BOOST_CHECK_EQUAL(moved->name, "a");
+
+    // Borrowing from the captured bytes isn't allowed since they move along
+    // with the Lazy.
+    StaticBox< Lazy< StaticBox<StringRef> > > borrow;
+    json = "{ \"value\": { \"value\": \"a\" } }";
+    BOOST_REQUIRE(!parse(json, borrow));
+    BOOST_CHECK_THROW(borrow.value.get(), reflect::Error);
+
+    // Errors in the captured bytes only surface on access.
+    StaticBox< Lazy<Record> > invalid;
+    json = "{ \"value\": { \"id\": 1 2 } }";
+    BOOST_REQUIRE(!parse(json, invalid));
+    BOOST_CHECK_THROW(invalid.value.get(), reflect::Error);
+}
@@ -128,6 +128,74 @@ BOOST_AUTO_TEST_CASE(test_number)
     checkToken("1.1.1", Token::Float, 1.1);
 }
 
+BOOST_AUTO_TEST_CASE(test_number_limits)
+{
+    auto checkInt = [] (const std::string& str, int64_t exp) {
+        Reader reader(str);
+        BOOST_CHECK_EQUAL(reader.expectToken(Token::Int).asInt(), exp);
+        BOOST_CHECK(!reader.error());
+    };
+
+    auto checkFloat = [] (const std::string& str, double exp) {
+        Reader reader(str);
+        BOOST_CHECK_EQUAL(reader.expectToken(Token::Float).asFloat(), exp);
+        BOOST_CHECK(!reader.error());
+    };
+
+    checkInt("12345678", 12345678);
+    checkInt("1234567890123456", 1234567890123456);
+    checkInt("9223372036854775807", INT64_MAX);
+    checkInt("-9223372036854775808", INT64_MIN);
+    checkInt("0000000000000000000000000042", 42);
+    checkInt("-0", 0);
+
+    errorToken("9223372036854775808");
+    errorToken("-9223372036854775809");
+    errorToken("99999999999999999999");
+    errorToken("-");
+    errorToken("1e");
+
+    // Exact comparisons since the conversion must be correctly rounded.
+    checkFloat("0.1", 0.1);
+    checkFloat("1.5", 1.5);
+    checkFloat("3.14159265358979", 3.14159265358979);
+    checkFloat("1e22", 1e22);
+    checkFloat("1e23", 1e23);
+    checkFloat("12e30", 12e30);
+    checkFloat("2.2250738585072014e-308", 2.2250738585072014e-308);
+    checkFloat("1.7976931348623157e308", 1.7976931348623157e308);
+    checkFloat("9007199254740993.0", 9007199254740993.0);
+    checkFloat("0.000000000000000000000000000001", 1e-30);
+    checkFloat("123456789012345678901234567890.5", 123456789012345678901234567890.5);
+    checkFloat("-0.0", -0.0);
+    checkFloat("1e-400", 0.0);
+
+    errorToken("1e400");
+
+    // Ints are valid floats.
+    std::string str = "12";
+    Reader reader(str);
+    BOOST_CHECK_EQUAL(reader.expectToken(Token::Int).asFloat(), 12.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_number_blocks)
+{
+    // Numbers that straddle two blocks of a stream.
+    for (size_t i = 1; i < 24; ++i) {
+        std::string pad(Reader::BlockSize - i, ' ');
+
+        std::istringstream intStream(pad + "-1234567890123456789 ]");
+        Reader intReader(intStream);
+        BOOST_CHECK_EQUAL(intReader.nextToken().asInt(), -1234567890123456789);
+        BOOST_CHECK_EQUAL(intReader.nextToken().type(), Token::ArrayEnd);
+
+        std::istringstream floatStream(pad + "-123456.789e-3 ]");
+        Reader floatReader(floatStream);
+        BOOST_CHECK_EQUAL(floatReader.nextToken().asFloat(), -123456.789e-3);
+        BOOST_CHECK_EQUAL(floatReader.nextToken().type(), Token::ArrayEnd);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_string)
 {
     auto s = [] (std::string str) { return '"' + str + '"'; };
@@ -183,4 +251,92 @@ BOOST_AUTO_TEST_CASE(test_string)
     errorToken(s(u({ 0xC0, 0x8F })));
     errorToken(s(u({ 0xE0, 0x8F })));
     errorToken(s(u({ 0xE0, 0x8F, 0x0F })));
+
+    checkToken(s(u({ 0xF0, 0x9F, 0x98, 0x80 })), Token::String, u({ 0xF0, 0x9F, 0x98, 0x80 }));
+    errorToken(s(u({ 0xED, 0xA0, 0x80 })));
+    errorToken(s(u({ 0xF4, 0x90, 0x80, 0x80 })));
+    errorToken(s(u({ 0xF8, 0x88, 0x80, 0x80, 0x80 })));
+}
+
+
+/******************************************************************************/
+/* BUFFER                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_buffer)
+{
+    std::string str = "[ \"abc\", 123 ]";
+    Reader reader(str.data(), str.data() + str.size());
+
+    BOOST_CHECK_EQUAL(reader.nextToken().type(), Token::ArrayStart);
+    BOOST_CHECK_EQUAL(reader.nextToken().asString(), "abc");
+    BOOST_CHECK_EQUAL(reader.nextToken().type(), Token::Separator);
+    BOOST_CHECK_EQUAL(reader.nextToken().asInt(), 123);
+    BOOST_CHECK_EQUAL(reader.nextToken().type(), Token::ArrayEnd);
+    BOOST_CHECK_EQUAL(reader.nextToken().type(), Token::EOS);
+    BOOST_CHECK(!reader.error());
+}
+
+BOOST_AUTO_TEST_CASE(test_borrow)
+{
+    std::string str = "[ \"abc\", \"\xC3\xA9t\xC3\xA9\", \"a\\nb\", \"\xC3\" ]";
+    Reader reader(str);
+
+    auto borrowed = [&] (StringRef ref) {
+        return ref.data() >= str.data() && ref.end() <= str.data() + str.size();
+    };
+
+    BOOST_CHECK_EQUAL(reader.nextToken().type(), Token::ArrayStart);
+
+    StringRef plain = reader.nextToken().asStringRef();
+    BOOST_CHECK_EQUAL(plain, "abc");
+    BOOST_CHECK(borrowed(plain));
+    reader.nextToken();
+
+    StringRef unicode = reader.nextToken().asStringRef();
+    BOOST_CHECK_EQUAL(unicode, "\xC3\xA9t\xC3\xA9");
+    BOOST_CHECK(borrowed(unicode));
+    reader.nextToken();
+
+    StringRef escaped = reader.nextToken().asStringRef();
+    BOOST_CHECK_EQUAL(escaped, "a\nb");
+    BOOST_CHECK(!borrowed(escaped));
+    reader.nextToken();
+
+    BOOST_CHECK(!reader.error());
+    reader.nextToken();
+    BOOST_CHECK(reader.error());
+}
+
+BOOST_AUTO_TEST_CASE(test_blocks)
+{
+    // Forces strings and whitespace to straddle the stream's blocks.
+    std::string big(Reader::BlockSize + 10, 'a');
+    std::string str = std::string(Reader::BlockSize - 3, ' ') + '"' + big + "\" 1";
+
+    std::istringstream stream(str);
+    Reader reader(stream);
+
+    BOOST_CHECK_EQUAL(reader.nextToken().asString(), big);
+    BOOST_CHECK_EQUAL(reader.nextToken().asInt(), 1);
+    BOOST_CHECK(!reader.error());
+}
+
+BOOST_AUTO_TEST_CASE(test_location)
+{
+    std::string str = "[\n  1,\n  2,\n  <";
+
+    Reader buffer(str);
+    while (buffer) buffer.nextToken();
+    BOOST_CHECK_EQUAL(buffer.line(), 4);
+    BOOST_CHECK_EQUAL(buffer.pos(), 4);
+    BOOST_CHECK(std::string(buffer.error().what()).find("4:4:") != std::string::npos);
+
+    std::string padded = std::string(Reader::BlockSize, '\n') + str;
+    std::istringstream stream(padded);
+    Reader blocks(stream);
+
+    while (blocks) blocks.nextToken();
+    BOOST_CHECK_EQUAL(blocks.line(), Reader::BlockSize + 4);
+    BOOST_CHECK_EQUAL(blocks.pos(), 4);
 }
@@ -0,0 +1,292 @@
+/* reuse_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the reuse of readers and writers across documents and for the
+   parsing of documents into the storage of an existing object.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "types/std/smart_ptr.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* ALLOCATIONS                                                                */
+/******************************************************************************/
+
+std::atomic<size_t> allocations(0);
+
+// Kept out of line so that gcc doesn't pair the malloc with the inlined
+// deletes of the standard containers and flag them as mismatched.
+__attribute__((noinline)) void* operator new(size_t size)
+{
+    allocations++;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+template<typename Fn>
+size_t countAllocations(const Fn& fn)
+{
+    size_t start = allocations;
+    fn();
+    return allocations - start;
+}
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+const Reader::Options Reuse = Reader::Options(Reader::Default | Reader::Reuse);
+
+std::string makeRecord(size_t id, size_t tags, const std::vector<std::string>& keys)
+{
+    std::string json = "{ \"id\": " + std::to_string(id);
+    json += ", \"name\": \"a name long enough to live on the heap " + std::to_string(id) + "\"";
+
+    json += ", \"tags\": [";
+    for (size_t i = 0; i < tags; ++i)
+        json += (i ? ", " : " ") + std::to_string(id + i);
+    json += " ]";
+
+    json += ", \"attributes\": {";
+    for (size_t i = 0; i < keys.size(); ++i) {
+        json += i ? ", " : " ";
+        json += "\"" + keys[i] + "\": \"value of the attribute " + keys[i] + "\"";
+    }
+    json += " } }";
+
+    return json;
+}
+
+std::string makeArray(size_t n, size_t tags, const std::vector<std::string>& keys)
+{
+    std::string json = "[";
+    for (size_t i = 0; i < n; ++i)
+        json += (i ? ", " : " ") + makeRecord(i, tags, keys);
+    return json + " ]";
+}
+
+const std::vector<std::string> Keys = {
+    "an attribute key that needs an allocation", "b", "c" };
+
+
+/******************************************************************************/
+/* SESSIONS                                                                   */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_reader_reset)
+{
+    Reader reader(nullptr, nullptr);
+
+    std::string bad = "{ \"id\": 1 ] }";
+    Record record;
+    reader.reset(bad);
+    parse(reader, record);
+    BOOST_CHECK(reader.error());
+
+    // Errors and positions don't carry over to the next document.
+    std::string good = "{ \"id\": 10 }";
+    reader.reset(good);
+    parse(reader, record);
+    BOOST_CHECK(!reader.error());
+    BOOST_CHECK_EQUAL(record.id, 10);
+
+    std::string next = "\n{ \"id\": 1 ]";
+    reader.reset(next);
+    parse(reader, record);
+    BOOST_REQUIRE(reader.error());
+    BOOST_CHECK_EQUAL(std::string(reader.error().what()).substr(0, 5), "2:12:");
+
+    std::stringstream stream("{ \"id\": 20 }");
+    reader.reset(stream);
+    parse(reader, record);
+    BOOST_CHECK(!reader.error());
+    BOOST_CHECK_EQUAL(record.id, 20);
+
+    std::stringstream other("{ \"id\": 30 }");
+    reader.reset(other);
+    parse(reader, record);
+    BOOST_CHECK(!reader.error());
+    BOOST_CHECK_EQUAL(record.id, 30);
+}
+
+BOOST_AUTO_TEST_CASE(test_writer_reset)
+{
+    std::string out;
+    Writer writer([&] (const char* data, size_t size) {
+                out.append(data, size);
+                return true;
+            });
+
+    Record record;
+    record.id = 10;
+
+    print(writer, record);
+    writer.error("boom");
+    BOOST_CHECK(!writer);
+
+    writer.reset();
+    BOOST_CHECK(writer);
+    BOOST_CHECK_EQUAL(out, print(record).first);
+
+    out.clear();
+    print(writer, record);
+    writer.flush();
+    BOOST_CHECK_EQUAL(out, print(record).first);
+}
+
+
+/******************************************************************************/
+/* REUSE                                                                      */
+/******************************************************************************/
+
+typedef boost::mpl::list<Record, Entry> Records;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_reuse, T, Records)
+{
+    Reader reader(nullptr, nullptr, Reuse);
+
+    std::vector<T> value;
+    std::string json = makeArray(4, 3, Keys);
+    reader.reset(json);
+    parse(reader, value);
+    BOOST_REQUIRE(!reader.error());
+    BOOST_REQUIRE_EQUAL(value.size(), 4u);
+
+    const T* data = value.data();
+    const int64_t* tags = value[0].tags.data();
+    const std::string* attribute = &value[0].attributes[Keys[0]];
+
+    // Same shape: everything is overwritten in place.
+    json = makeArray(4, 3, Keys);
+    reader.reset(json);
+    parse(reader, value);
+    BOOST_REQUIRE(!reader.error());
+    BOOST_CHECK_EQUAL(value.size(), 4u);
+    BOOST_CHECK_EQUAL(value.data(), data);
+    BOOST_CHECK_EQUAL(value[0].tags.data(), tags);
+    BOOST_CHECK_EQUAL(&value[0].attributes[Keys[0]], attribute);
+
+    // Smaller: truncated instead of appended to.
+    json = makeArray(2, 1, { "b", "d" });
+    reader.reset(json);
+    parse(reader, value);
+    BOOST_REQUIRE(!reader.error());
+    BOOST_REQUIRE_EQUAL(value.size(), 2u);
+    BOOST_CHECK_EQUAL(value.data(), data);
+    BOOST_CHECK_EQUAL(value[1].id, 1);
+    BOOST_CHECK_EQUAL(value[1].tags.size(), 1u);
+    BOOST_CHECK_EQUAL(value[1].tags[0], 1);
+    BOOST_CHECK_EQUAL(value[1].attributes.size(), 2u);
+    BOOST_CHECK_EQUAL(value[1].attributes.count("b"), 1u);
+    BOOST_CHECK_EQUAL(value[1].attributes.count("d"), 1u);
+
+    // Larger: grows past the existing elements.
+    json = makeArray(5, 2, Keys);
+    reader.reset(json);
+    parse(reader, value);
+    BOOST_REQUIRE(!reader.error());
+    BOOST_REQUIRE_EQUAL(value.size(), 5u);
+    BOOST_CHECK_EQUAL(value[4].id, 4);
+    BOOST_CHECK_EQUAL(value[4].tags.size(), 2u);
+    BOOST_CHECK_EQUAL(value[4].attributes.size(), 3u);
+
+    std::string empty = "{ \"id\": 1, \"tags\": [], \"attributes\": null }";
+    T single;
+    single.tags = { 1, 2, 3 };
+    single.attributes["a"] = "a";
+    reader.reset(empty);
+    parse(reader, single);
+    BOOST_REQUIRE(!reader.error());
+    BOOST_CHECK(single.tags.empty());
+    BOOST_CHECK(single.attributes.empty());
+
+    // Without the option the existing elements are appended to.
+    BOOST_CHECK(!json::parse(json, value));
+    BOOST_CHECK_EQUAL(value.size(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(test_reuse_pointee)
+{
+    // Existing pointees are parsed into instead of being replaced.
+    Entry entry;
+    entry.next = std::make_shared<Entry>();
+    Entry* next = entry.next.get();
+
+    Reader reader(nullptr, nullptr, Reuse);
+    std::string json = "{ \"next\": { \"id\": 2, \"tags\": [ 1 ] } }";
+    reader.reset(json);
+    parse(reader, entry);
+    BOOST_REQUIRE(!reader.error());
+    BOOST_CHECK_EQUAL(entry.next.get(), next);
+    BOOST_CHECK_EQUAL(next->id, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_reuse_nested_maps)
+{
+    typedef std::map<std::string, std::map<std::string, int64_t> > Map;
+
+    Map value;
+    Reader reader(nullptr, nullptr, Reuse);
+
+    std::string json = "{ \"a\": { \"x\": 1, \"y\": 2 }, \"b\": { \"z\": 3 } }";
+    reader.reset(json);
+    parse(reader, value);
+    BOOST_REQUIRE(!reader.error());
+
+    json = "{ \"b\": { \"w\": 4 }, \"c\": {} }";
+    reader.reset(json);
+    parse(reader, value);
+    BOOST_REQUIRE(!reader.error());
+
+    BOOST_CHECK_EQUAL(value.size(), 2u);
+    BOOST_CHECK_EQUAL(value.count("a"), 0u);
+    BOOST_REQUIRE_EQUAL(value["b"].size(), 1u);
+    BOOST_CHECK_EQUAL(value["b"]["w"], 4);
+    BOOST_CHECK(value["c"].empty());
+}
+
+// The dynamic codec still boxes the arguments of the reflected container
+// functions so only the static codec is allocation free.
+BOOST_AUTO_TEST_CASE(test_reuse_allocations)
+{
+    std::string json = makeArray(16, 8, Keys);
+
+    std::vector<Record> value;
+    Reader reader(nullptr, nullptr, Reuse);
+
+    for (size_t i = 0; i < 2; ++i) {
+        reader.reset(json);
+        parse(reader, value);
+        BOOST_REQUIRE(!reader.error());
+    }
+
+    size_t allocs = countAllocations([&] {
+                reader.reset(json);
+                parse(reader, value);
+            });
+
+    BOOST_CHECK(!reader.error());
+    BOOST_CHECK_EQUAL(allocs, 0u);
+    BOOST_CHECK_EQUAL(value.size(), 16u);
+}
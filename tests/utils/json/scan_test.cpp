@@ -0,0 +1,298 @@
+/* scan_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Checks that the vectorized scanning kernels match the scalar kernels.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "reflect.h"
+#include "utils/json.h"
+
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <cstring>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+std::vector<ScanIsa> isas()
+{
+    std::vector<ScanIsa> result;
+    for (ScanIsa isa : { ScanIsa::Scalar, ScanIsa::Sse2, ScanIsa::Avx2 })
+        if (scanSupported(isa)) result.push_back(isa);
+    return result;
+}
+
+// Every offset of every prefix of the buffer so that all the stop positions
+// fall both within the vectorized loop and within the scalar tail.
+template<typename Fn>
+void checkKernel(const std::string& buffer, Fn&& fn)
+{
+    ScanIsa original = scanIsa();
+
+    for (size_t first = 0; first < buffer.size(); ++first) {
+        for (size_t last = first; last <= buffer.size(); ++last) {
+            const char* it = buffer.data() + first;
+            const char* end = buffer.data() + last;
+
+            scanIsa(ScanIsa::Scalar);
+            const char* exp = fn(it, end);
+
+            for (ScanIsa isa : isas()) {
+                scanIsa(isa);
+                const char* result = fn(it, end);
+                if (result == exp) continue;
+
+                BOOST_ERROR("isa " << unsigned(isa) << " at ["
+                        << first << ", " << last << "): "
+                        << (result - buffer.data()) << " != "
+                        << (exp - buffer.data()));
+            }
+        }
+    }
+
+    scanIsa(original);
+}
+
+std::string randomBuffer(const std::string& alphabet, size_t size, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> dist(0, alphabet.size() - 1);
+
+    std::string result;
+    for (size_t i = 0; i < size; ++i) result += alphabet[dist(rng)];
+    return result;
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_space)
+{
+    std::string alphabet = " \t\n\v\f\r\x08\x0E\x1F!a\x80\xFF";
+
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        std::string buffer = std::string(40, ' ') + randomBuffer(alphabet, 40, seed);
+        checkKernel(buffer, [] (const char* it, const char* end) {
+                    return json::details::skipSpace(it, end);
+                });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_string)
+{
+    std::string alphabet = "abcdefgh\"\\\n\t\x01\x1F\x20\x7F\x80\xC3\xFF";
+
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        std::string buffer = std::string(40, 'a') + randomBuffer(alphabet, 40, seed);
+
+        for (bool high : { false, true }) {
+            checkKernel(buffer, [=] (const char* it, const char* end) {
+                        return json::details::scanString(it, end, high);
+                    });
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_tokens)
+{
+    std::string value = "\"" + std::string(100, 'x') + "\\n\\u00e9\xC3\xA9\t" +
+        std::string(50, 'y') + "\"";
+    std::string doc = std::string(70, ' ') + "[ " + value + " ,\n\t" + value + " ]";
+
+    std::vector<std::string> exp;
+    for (ScanIsa isa : isas()) {
+        scanIsa(isa);
+
+        Reader reader(doc);
+        std::vector<std::string> result;
+
+        Token token;
+        while ((token = reader.nextToken()).type() != Token::EOS)
+            result.push_back(token.print());
+
+        BOOST_CHECK(!reader.error());
+        if (exp.empty()) exp = result;
+        else BOOST_CHECK(result == exp);
+    }
+}
+
+// Escapes are applied everywhere, including outside of strings, which is what
+// the structural index does as well.
+std::vector<uint32_t> structurals(const std::string& buffer)
+{
+    std::vector<uint32_t> result;
+    bool inString = false;
+    bool escaped = false;
+
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        char c = buffer[i];
+
+        if (escaped) {
+            escaped = false;
+            if (c == '"' || c == '\\') continue;
+        }
+        else if (c == '\\') {
+            escaped = true;
+            continue;
+        }
+
+        if (c == '"') inString = !inString;
+        else if (!inString && std::strchr("{}[],:", c)) result.push_back(i);
+    }
+
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(test_structurals)
+{
+    std::string alphabet = "ab \"\"\\\\\\{}[],:\x0C\x1A\x80";
+    ScanIsa original = scanIsa();
+
+    for (unsigned seed = 0; seed < 16; ++seed) {
+        std::string buffer = randomBuffer(alphabet, 64 * 5 + seed * 7, seed);
+        std::vector<uint32_t> exp = structurals(buffer);
+
+        for (ScanIsa isa : isas()) {
+            scanIsa(isa);
+
+            std::vector<uint32_t> result;
+            json::details::indexStructurals(
+                    buffer.data(), buffer.data() + buffer.size(), result);
+
+            BOOST_CHECK_MESSAGE(result == exp,
+                    "isa " << unsigned(isa) << " seed " << seed);
+        }
+    }
+
+    scanIsa(original);
+}
+
+BOOST_AUTO_TEST_CASE(test_nested)
+{
+    std::string alphabet = "ab \"\"\\\\{}[]{}[],:";
+
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        std::string buffer = randomBuffer(alphabet, 80, seed);
+
+        for (size_t depth : { 1, 3 }) {
+            checkKernel(buffer, [=] (const char* it, const char* end) {
+                        json::details::SkipState state(depth);
+                        return json::details::skipNested(it, end, state);
+                    });
+        }
+    }
+}
+
+// The state carries over from one buffer to the next.
+BOOST_AUTO_TEST_CASE(test_nested_split)
+{
+    std::string value = "[ \"]\\\"\\\\\", { \"a\": [ \"}\" ] }, [[]], \"\\\\\" ]";
+    std::string buffer = std::string(100, ' ') + value + std::string(100, ' ');
+    ScanIsa original = scanIsa();
+
+    for (ScanIsa isa : isas()) {
+        scanIsa(isa);
+
+        for (size_t split = 0; split <= buffer.size(); ++split) {
+            const char* first = buffer.data() + 100;
+            const char* mid = buffer.data() + std::max<size_t>(split, 101);
+            const char* last = buffer.data() + buffer.size();
+
+            json::details::SkipState state(1);
+            const char* it = json::details::skipNested(first + 1, mid, state);
+            if (state.depth) it = json::details::skipNested(mid, last, state);
+
+            BOOST_CHECK_EQUAL(it - buffer.data(), 100 + value.size());
+            BOOST_CHECK_EQUAL(state.depth, 0u);
+        }
+    }
+
+    scanIsa(original);
+}
+
+// Whole characters, both valid and not, so that most sequences are complete.
+std::string randomText(size_t size, unsigned seed)
+{
+    static const std::vector<std::string> chars = {
+        "a", "b", " ", "\"", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80",
+        "\xDF\xBF", "\xEF\xBF\xBF", "\xF4\x8F\xBF\xBF",
+        "\xC0\x80", "\xE0\x9F\xBF", "\xF0\x8F\xBF\xBF", "\xED\xA0\x80",
+        "\xF4\x90\x80\x80", "\xF8", "\x80", "\xC3", "\xE2\x82", "\xFF" };
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> dist(0, chars.size() - 1);
+
+    // Mostly valid characters so that errors don't all land up front.
+    std::uniform_int_distribution<size_t> validDist(0, 9);
+
+    std::string result;
+    while (result.size() < size)
+        result += chars[rng() % 8 ? validDist(rng) : dist(rng)];
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(test_utf8)
+{
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        std::string buffer = std::string(40, 'a') + randomText(60, seed);
+        checkKernel(buffer, [] (const char* it, const char* end) {
+                    return json::details::validateUtf8(it, end);
+                });
+    }
+}
+
+// Every sequence at every offset of the blocks and across their boundaries.
+BOOST_AUTO_TEST_CASE(test_utf8_sequences)
+{
+    std::vector<std::string> valid = {
+        "\x7F", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF",
+        "\xEE\x80\x80", "\xEF\xBF\xBF", "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF" };
+
+    std::vector<std::string> invalid = {
+        "\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xC2", "\xC2\x41", "\xC2\xC2\x80",
+        "\xE0\x80\x80", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xED\xBF\xBF",
+        "\xE1\x80", "\xE1\x80\x41", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF",
+        "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF1\x80\x80", "\xF8\x88\x80\x80\x80",
+        "\xFF", "\xC2\x80\x80", "\xF0\x90\x80\x80\x80" };
+
+    ScanIsa original = scanIsa();
+
+    for (ScanIsa isa : isas()) {
+        scanIsa(isa);
+
+        for (size_t offset = 0; offset < 100; ++offset) {
+            for (const auto& seq : valid) {
+                std::string buffer = std::string(offset, 'a') + seq + std::string(70, 'b');
+                const char* end = buffer.data() + buffer.size();
+
+                BOOST_CHECK_MESSAGE(json::details::validateUtf8(buffer.data(), end) == end,
+                        "isa " << unsigned(isa) << " offset " << offset);
+            }
+
+            for (const auto& seq : invalid) {
+                for (size_t padding : { size_t(0), size_t(70) }) {
+                    std::string buffer = std::string(offset, 'a') + seq + std::string(padding, 'b');
+                    const char* end = buffer.data() + buffer.size();
+
+                    const char* it = json::details::validateUtf8(buffer.data(), end);
+                    BOOST_CHECK_MESSAGE(it != end && it >= buffer.data() + offset,
+                            "isa " << unsigned(isa) << " offset " << offset);
+                }
+            }
+        }
+    }
+
+    scanIsa(original);
+}
@@ -0,0 +1,407 @@
+/* static_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Checks that the static json codec matches the dynamic one.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/map.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+#include "types/std/smart_ptr.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* TYPES                                                                      */
+/******************************************************************************/
+
+struct Item
+{
+    Item() : id(0), price(0), active(false) {}
+
+    int64_t id;
+    double price;
+    std::string name;
+    std::vector<int64_t> tags;
+    bool active;
+
+    bool operator==(const Item& other) const
+    {
+        return staticEqual(*this, other);
+    }
+};
+
+struct Order
+{
+    Order() : hidden(0), renamed(0) {}
+
+    std::string customer;
+    std::vector<Item> items;
+    std::map<std::string, int64_t> counts;
+    std::shared_ptr<Item> featured;
+    std::vector<Custom> customs;
+    int64_t hidden;
+    int64_t renamed;
+};
+
+reflectStaticFields(Item, id, price, name, tags, active)
+reflectStaticFields(Order,
+        customer, items, counts, featured, customs, hidden, renamed)
+
+reflectType(Item)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+}
+
+reflectType(Order)
+{
+    reflectPlumbing();
+    reflectStatic();
+
+    reflectFieldValue(hidden, json, json::skip());
+    reflectFieldValue(renamed, json, json::alias("bob"));
+    reflectFieldValue(featured, json, json::skipEmpty());
+}
+
+// Same fields with one going through the static codec and the other through the
+// dynamic one.
+struct Narrow
+{
+    Narrow() : i8(0), u8(0), u16(0), f(0) {}
+
+    int8_t i8;
+    uint8_t u8;
+    uint16_t u16;
+    float f;
+};
+
+struct DynamicNarrow : public Narrow {};
+
+reflectStaticFields(Narrow, i8, u8, u16, f)
+
+reflectType(Narrow)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+}
+
+reflectType(DynamicNarrow)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(i8);
+    reflectField(u8);
+    reflectField(u16);
+    reflectField(f);
+}
+
+Order makeOrder()
+{
+    Order order;
+    order.customer = "bob \"the\" builder";
+
+    for (size_t i = 0; i < 3; ++i) {
+        Item item;
+        item.id = i * 10;
+        item.price = i + 0.25;
+        item.name = "item" + std::to_string(i);
+        item.tags = { int64_t(i), int64_t(-i) };
+        item.active = i % 2;
+        order.items.push_back(item);
+    }
+
+    order.counts["a"] = 1;
+    order.counts["b"] = 2;
+    order.customs = { Custom(1), Custom(2) };
+    order.hidden = 10;
+    order.renamed = 20;
+
+    return order;
+}
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+template<typename T>
+std::string printStatic(const T& value, Writer::Options options)
+{
+    std::stringstream ss;
+    Writer writer(ss, options);
+    json::print(writer, value);
+    BOOST_CHECK(!writer.error());
+    return ss.str();
+}
+
+template<typename T>
+std::string printDynamic(const T& value, Writer::Options options)
+{
+    std::stringstream ss;
+    Writer writer(ss, options);
+    json::print(writer, cast<Value>(value));
+    BOOST_CHECK(!writer.error());
+    return ss.str();
+}
+
+template<typename T>
+void checkPrint(const T& value)
+{
+    Writer::Options pretty = Writer::Options(Writer::Default | Writer::Pretty);
+    Writer::Options compact = Writer::Options(Writer::Default | Writer::Compact);
+
+    BOOST_CHECK_EQUAL(printStatic(value, pretty), printDynamic(value, pretty));
+    BOOST_CHECK_EQUAL(printStatic(value, compact), printDynamic(value, compact));
+}
+
+template<typename T>
+T parseDynamic(const std::string& str)
+{
+    T value;
+    std::istringstream stream(str);
+    Reader reader(stream);
+
+    Value v = cast<Value>(value);
+    json::parse(reader, v);
+    BOOST_CHECK(!reader.error());
+
+    return value;
+}
+
+template<typename T>
+T parseStatic(const std::string& str)
+{
+    T value;
+    BOOST_CHECK(!json::parse(str, value));
+    return value;
+}
+
+
+/******************************************************************************/
+/* PRINT                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(static_print)
+{
+    Order order = makeOrder();
+    checkPrint(order);
+
+    order.featured = std::make_shared<Item>(order.items[1]);
+    checkPrint(order);
+
+    checkPrint(order.items);
+    checkPrint(order.counts);
+    checkPrint(Order());
+}
+
+
+/******************************************************************************/
+/* PARSE                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(static_parse)
+{
+    Order order = makeOrder();
+    order.featured = std::make_shared<Item>(order.items[2]);
+
+    std::string str = json::print(order).first;
+    Order sOrder = parseStatic<Order>(str);
+    Order dOrder = parseDynamic<Order>(str);
+
+    for (const Order* result : { &sOrder, &dOrder }) {
+        BOOST_CHECK_EQUAL(result->customer, order.customer);
+        BOOST_CHECK(result->items == order.items);
+        BOOST_CHECK(result->counts == order.counts);
+        BOOST_CHECK(result->customs == order.customs);
+        BOOST_CHECK_EQUAL(result->hidden, 0);
+        BOOST_CHECK_EQUAL(result->renamed, order.renamed);
+
+        BOOST_REQUIRE(result->featured);
+        BOOST_CHECK(*result->featured == *order.featured);
+    }
+
+    BOOST_CHECK_EQUAL(json::print(sOrder).first, json::print(dOrder).first);
+}
+
+BOOST_AUTO_TEST_CASE(parse_unknown)
+{
+    std::string str = "{ \"id\": 1, \"blah\": [ 1, { \"a\": 2 } ], \"name\": \"x\" }";
+
+    Item item = parseStatic<Item>(str);
+    BOOST_CHECK_EQUAL(item.id, 1);
+    BOOST_CHECK_EQUAL(item.name, "x");
+
+    Order order;
+    std::string nulls = "{ \"featured\": null, \"items\": null }";
+    BOOST_CHECK(!json::parse(nulls, order));
+    BOOST_CHECK(!order.featured);
+}
+
+BOOST_AUTO_TEST_CASE(parse_narrowing)
+{
+    auto check = [] (const std::string& str) {
+        Narrow sValue;
+        json::Error sError = json::parse(str, sValue);
+
+        DynamicNarrow dValue;
+        json::Error dError = json::parse(str, dValue);
+
+        BOOST_CHECK_EQUAL(bool(sError), bool(dError));
+        BOOST_CHECK_EQUAL(sError.what(), dError.what());
+        BOOST_CHECK_EQUAL(sValue.i8, dValue.i8);
+        BOOST_CHECK_EQUAL(sValue.u8, dValue.u8);
+        BOOST_CHECK_EQUAL(sValue.u16, dValue.u16);
+        BOOST_CHECK_EQUAL(sValue.f, dValue.f);
+
+        return sError ? std::string(sError.what()) : "";
+    };
+
+    std::string str = "{ \"i8\": -128, \"u8\": 255, \"u16\": 65535, \"f\": 1.5 }";
+    BOOST_CHECK_EQUAL(check(str), "");
+
+    Narrow value;
+    BOOST_CHECK(!json::parse(str, value));
+    BOOST_CHECK_EQUAL(value.i8, -128);
+    BOOST_CHECK_EQUAL(value.u8, 255);
+    BOOST_CHECK_EQUAL(value.u16, 65535);
+    BOOST_CHECK_EQUAL(value.f, 1.5);
+
+    for (std::string bad : {
+                "{ \"i8\": 128 }",
+                "{ \"i8\": -129 }",
+                "{ \"u8\": 256 }",
+                "{ \"u8\": -1 }",
+                "{ \"u16\": 65536 }",
+                "{ \"f\": 1e39 }" })
+    {
+        BOOST_CHECK_NE(check(bad), "");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parse_containers)
+{
+    typedef std::map<std::string, std::vector<int64_t> > Map;
+    std::string str = "{ \"a\": [ 1, 2 ], \"b\": [], \"a\": [ 3 ] }";
+
+    // Duplicate keys replace the previous value instead of appending to it.
+    Map sMap = parseStatic<Map>(str);
+    Map dMap = parseDynamic<Map>(str);
+    BOOST_CHECK(sMap == dMap);
+    BOOST_CHECK(sMap["a"] == std::vector<int64_t>({ 3 }));
+    BOOST_CHECK(sMap["b"].empty());
+
+    // Arrays are appended to existing content.
+    std::vector<Item> sItems(1), dItems(1);
+    str = "[ { \"id\": 1, \"tags\": [ 2 ] }, { \"id\": 3 } ]";
+
+    BOOST_CHECK(!json::parse(str, sItems));
+
+    Value value = cast<Value>(dItems);
+    Reader reader(str);
+    json::parse(reader, value);
+    BOOST_CHECK(!reader.error());
+
+    BOOST_REQUIRE_EQUAL(sItems.size(), 3u);
+    BOOST_CHECK(sItems == dItems);
+    BOOST_CHECK_EQUAL(sItems[1].id, 1);
+    BOOST_CHECK(sItems[1].tags == std::vector<int64_t>({ 2 }));
+    BOOST_CHECK_EQUAL(sItems[2].id, 3);
+}
+
+BOOST_AUTO_TEST_CASE(parse_skip)
+{
+    std::string unknown =
+        "{ \"a\": [ \"]\\\"}\", { \"b\": \"\\\\\" }, [[], {}] ], \"c\": \"{\" }";
+    std::string str = "{ \"id\": 1, \"blah\": " + unknown + ", \"name\": \"x\" }";
+
+    BOOST_CHECK_EQUAL(parseStatic<Item>(str).name, "x");
+    BOOST_CHECK_EQUAL(parseDynamic<Item>(str).name, "x");
+
+    // Large enough to span several blocks of a stream reader.
+    std::string large = "[";
+    for (size_t i = 0; i < 10 * 1000; ++i) large += unknown + ", ";
+    large += "\"}\" ]";
+
+    str = "{ \"blah\": " + large + ", \"id\": 2 }";
+    BOOST_CHECK_EQUAL(parseStatic<Item>(str).id, 2);
+    BOOST_CHECK_EQUAL(parseDynamic<Item>(str).id, 2);
+
+    // Deep enough to overflow the stack of a recursive skip.
+    size_t depth = 1000 * 1000;
+    str = "{ \"blah\": " + std::string(depth, '[') + std::string(depth, ']') +
+        ", \"id\": 3 }";
+    BOOST_CHECK_EQUAL(parseStatic<Item>(str).id, 3);
+
+    // Still tokenized when comments are allowed.
+    str = "{ \"blah\": [ 1, // ] }\n 2 ], \"id\": 4 }";
+    Item item;
+    Reader reader(str, Reader::Options(Reader::Default | Reader::AllowComments));
+    json::parse(reader, item);
+    BOOST_CHECK(!reader.error());
+    BOOST_CHECK_EQUAL(item.id, 4);
+
+    Item bad;
+    std::string truncated = "{ \"blah\": [ \"a\" ";
+    BOOST_CHECK(json::parse(truncated, bad));
+}
+
+BOOST_AUTO_TEST_CASE(parse_rollback)
+{
+    auto parseDyn = [] (const std::string& str, Value value) {
+        Reader reader(str);
+        json::parse(reader, value);
+        return reader.error();
+    };
+
+    // A failed element isn't left behind in the vector.
+    std::string str = "[ { \"u8\": 1, \"i8\": 1 }, { \"u8\": 2, \"i8\": 300 } ]";
+
+    std::vector<Narrow> sVector;
+    BOOST_CHECK(json::parse(str, sVector));
+    BOOST_REQUIRE_EQUAL(sVector.size(), 1u);
+    BOOST_CHECK_EQUAL(sVector[0].u8, 1);
+
+    std::vector<DynamicNarrow> dVector;
+    BOOST_CHECK(parseDyn(str, cast<Value>(dVector)));
+    BOOST_REQUIRE_EQUAL(dVector.size(), 1u);
+    BOOST_CHECK_EQUAL(dVector[0].u8, 1);
+
+    // Nor is a failed value for a new key in the map.
+    str = "{ \"a\": { \"u8\": 1 }, \"b\": { \"u8\": 2, \"i8\": 300 } }";
+
+    std::map<std::string, Narrow> sMap;
+    BOOST_CHECK(json::parse(str, sMap));
+    BOOST_REQUIRE_EQUAL(sMap.size(), 1u);
+    BOOST_CHECK_EQUAL(sMap["a"].u8, 1);
+
+    std::map<std::string, DynamicNarrow> dMap;
+    BOOST_CHECK(parseDyn(str, cast<Value>(dMap)));
+    BOOST_REQUIRE_EQUAL(dMap.size(), 1u);
+    BOOST_CHECK_EQUAL(dMap["a"].u8, 1);
+
+    // And a failed value for an existing key leaves the previous one intact.
+    str = "{ \"k\": { \"i8\": 300 } }";
+
+    sMap["k"].u8 = 42;
+    BOOST_CHECK(json::parse(str, sMap));
+    BOOST_CHECK_EQUAL(sMap["k"].u8, 42);
+
+    dMap["k"].u8 = 42;
+    BOOST_CHECK(parseDyn(str, cast<Value>(dMap)));
+    BOOST_CHECK_EQUAL(dMap["k"].u8, 42);
+}
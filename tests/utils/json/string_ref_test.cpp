@@ -0,0 +1,194 @@
+/* string_ref_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the parsing of strings into views of the input.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
+#include "types/std/vector.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+typedef boost::mpl::list< StaticBox<StringRef>, DynamicBox<StringRef> > Boxes;
+
+const std::string Doc =
+    "{ \"id\": 1, \"value\": \"plain\", \"values\": [ \"a\\\"b\", \"\", \"c\\u00e9\" ] }";
+
+bool within(StringRef ref, const std::string& input)
+{
+    return ref.data() >= input.data() && ref.data() < input.data() + input.size();
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_parse, Box, Boxes)
+{
+    Arena arena;
+    Reader reader(Doc);
+    reader.arena(&arena);
+
+    Box box;
+    parse(reader, box);
+    BOOST_REQUIRE(!reader.error());
+
+    // Strings that don't need unescaping point straight into the input.
+    BOOST_CHECK_EQUAL(box.value, "plain");
+    BOOST_CHECK(within(box.value, Doc));
+
+    // Everything else is copied into the arena.
+    BOOST_REQUIRE_EQUAL(box.values.size(), 3u);
+    BOOST_CHECK_EQUAL(box.values[0], "a\"b");
+    BOOST_CHECK(!within(box.values[0], Doc));
+    BOOST_CHECK(box.values[1].empty());
+    BOOST_CHECK_EQUAL(box.values[2], "c\xc3\xa9");
+    BOOST_CHECK(box.values[0].data() != box.values[2].data());
+
+    // Printing emits the views as is.
+    std::string expected =
+        "{\"id\":1,\"value\":\"plain\",\"values\":[\"a\\\"b\",\"\",\"c\\u00e9\"]}";
+    BOOST_CHECK_EQUAL(print(box).first, expected);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_arena, Box, Boxes)
+{
+    Arena arena(1024);
+
+    Box box;
+    BOOST_REQUIRE(!parse(Doc, box, arena));
+    BOOST_CHECK(within(box.value, Doc));
+
+    // Copies outlive the reader when they're kept in an arena.
+    BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+    BOOST_CHECK_EQUAL(box.values[0], "a\"b");
+    BOOST_CHECK_EQUAL(box.values[2], "c\xc3\xa9");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_no_arena, Box, Boxes)
+{
+    // Strings that need unescaping have nowhere to go.
+    Box box;
+    BOOST_CHECK(parse(Doc, box));
+
+    // Borrowing alone doesn't need one.
+    std::string json = "{ \"value\": \"plain\", \"values\": [ \"a\" ] }";
+    Box other;
+    BOOST_REQUIRE(!parse(json, other));
+    BOOST_CHECK(within(other.value, json));
+    BOOST_CHECK(within(other.values[0], json));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_stream, Box, Boxes)
+{
+    // A stream doesn't outlive its blocks so everything is copied.
+    Arena arena;
+    std::stringstream stream(Doc);
+    Reader reader(stream);
+    reader.arena(&arena);
+
+    Box box;
+    parse(reader, box);
+    BOOST_REQUIRE(!reader.error());
+
+    BOOST_CHECK_EQUAL(box.value, "plain");
+    BOOST_CHECK(!within(box.value, Doc));
+    BOOST_CHECK_EQUAL(box.values[0], "a\"b");
+
+    std::stringstream other(Doc);
+    BOOST_CHECK(parse(other, box));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_push, Box, Boxes)
+{
+    // Chunks don't outlive the feed either.
+    Arena arena;
+    Box box;
+    PushParser parser(cast<Value>(box));
+    parser.arena(&arena);
+
+    for (char c : Doc) parser.feed(&c, 1);
+    BOOST_REQUIRE(parser.ok());
+    BOOST_REQUIRE(parser.done());
+
+    BOOST_CHECK_EQUAL(box.value, "plain");
+    BOOST_CHECK_EQUAL(box.values[0], "a\"b");
+    BOOST_CHECK_EQUAL(box.values[2], "c\xc3\xa9");
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel)
+{
+    typedef StaticBox<StringRef> Box;
+    ParallelThreads guard(4);
+
+    auto makeJson = [] (const std::string& escape) {
+        std::string json = "[";
+        for (size_t i = 0; i < 32 * 1024; ++i) {
+            json += i ? ", " : " ";
+            json += "{ \"id\": " + std::to_string(i) + ", \"value\": \"n" + std::to_string(i) + "\"";
+            json += ", \"values\": [ \"" + escape + std::to_string(i) + "\" ] }";
+        }
+        return json + " ]";
+    };
+
+    // The threads borrow from the input.
+    std::string json = makeJson("v");
+    BOOST_REQUIRE_GT(json.size(), size_t(ParallelMinSize));
+
+    Reader reader(json);
+    std::vector<Box> boxes;
+    parse(reader, boxes);
+    BOOST_REQUIRE(!reader.error());
+
+    BOOST_REQUIRE_EQUAL(boxes.size(), 32u * 1024);
+    for (size_t i = 0; i < boxes.size(); i += 1021) {
+        BOOST_CHECK(within(boxes[i].value, json));
+        BOOST_CHECK_EQUAL(boxes[i].value, "n" + std::to_string(i));
+        BOOST_CHECK(within(boxes[i].values[0], json));
+        BOOST_CHECK_EQUAL(boxes[i].values[0], "v" + std::to_string(i));
+    }
+
+    // Escaped strings need an arena which isn't shared with the threads so
+    // the array is parsed sequentially instead.
+    json = makeJson("\\t");
+
+    boxes.clear();
+    BOOST_CHECK(parse(json, boxes));
+
+    Arena arena;
+    boxes.clear();
+    BOOST_REQUIRE(!parse(json, boxes, arena));
+    BOOST_REQUIRE_EQUAL(boxes.size(), 32u * 1024);
+    for (size_t i = 0; i < boxes.size(); i += 1021)
+        BOOST_CHECK_EQUAL(boxes[i].values[0], "\t" + std::to_string(i));
+}
+
+BOOST_AUTO_TEST_CASE(test_reflection)
+{
+    const Type* type = reflect::type<StringRef>();
+    BOOST_CHECK(type->is("string"));
+    BOOST_CHECK(type->hasConverter<std::string>());
+
+    StringRef ref("bob");
+    Value value(ref);
+    BOOST_CHECK_EQUAL(value.call<size_t>("size"), 3u);
+    BOOST_CHECK_EQUAL(cast<std::string>(value), "bob");
+}
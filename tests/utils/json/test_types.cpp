@@ -12,6 +12,8 @@
 #include "types/std/string.h"
 #include "types/std/smart_ptr.h"
 
+#include <fstream>
+
 
 /******************************************************************************/
 /* CUSTOM                                                                     */
@@ -207,3 +209,76 @@ reflectTypeImpl(Basics)
     reflectField(next);
     reflectFieldValue(next, json, json::skipEmpty());
 }
+
+
+/******************************************************************************/
+/* RECORD                                                                     */
+/******************************************************************************/
+
+bool
+Record::
+operator==(const Record& other) const
+{
+    return id == other.id
+        && name == other.name
+        && tags == other.tags
+        && attributes == other.attributes;
+}
+
+reflectTypeImpl(Record)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+}
+
+bool
+Entry::
+operator==(const Entry& other) const
+{
+    if (!next != !other.next) return false;
+    if (next && !(*next == *other.next)) return false;
+
+    return id == other.id
+        && name == other.name
+        && tags == other.tags
+        && attributes == other.attributes;
+}
+
+reflectTypeImpl(Entry)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(id);
+    reflectField(name);
+    reflectField(tags);
+    reflectField(attributes);
+    reflectField(next);
+}
+
+std::string recordName(size_t i)
+{
+    return "[rec\"ord\\\", {" + std::to_string(i) + "}:";
+}
+
+std::string recordJson(size_t i)
+{
+    std::stringstream ss;
+    ss  << "{ \"id\": " << i
+        << ", \"name\": \"[rec\\\"ord\\\\\\\", {" << i << "}:\""
+        << ", \"tags\": [ " << i << ", " << i * 2 << " ] }";
+    return ss.str();
+}
+
+
+/******************************************************************************/
+/* FILES                                                                      */
+/******************************************************************************/
+
+std::string readFile(const std::string& file)
+{
+    std::ifstream stream("tests/utils/json/" + file);
+    return std::string(
+            std::istreambuf_iterator<char>(stream),
+            std::istreambuf_iterator<char>());
+}
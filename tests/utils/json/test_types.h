@@ -7,6 +7,8 @@
 
 #include "reflect.h"
 #include "utils/json.h"
+#include "dsl/all.h"
+#include "types/std/vector.h"
 
 #include <map>
 #include <vector>
@@ -104,3 +106,117 @@ OStream& operator<< (OStream& stream, const Basics& obj)
 }
 
 reflectTypeDecl(Basics)
+
+
+/******************************************************************************/
+/* RECORD                                                                     */
+/******************************************************************************/
+
+// Goes through the static codec.
+struct Record
+{
+    Record() : id(0) {}
+
+    int64_t id;
+    std::string name;
+    std::vector<int64_t> tags;
+    std::map<std::string, std::string> attributes;
+
+    bool operator==(const Record& other) const;
+};
+
+reflectStaticFields(Record, id, name, tags, attributes)
+reflectTypeDecl(Record)
+
+// Same fields as Record but goes through the dynamic codec.
+struct Entry
+{
+    Entry() : id(0) {}
+
+    int64_t id;
+    std::string name;
+    std::vector<int64_t> tags;
+    std::map<std::string, std::string> attributes;
+    std::shared_ptr<Entry> next;
+
+    bool operator==(const Entry& other) const;
+};
+
+reflectTypeDecl(Entry)
+
+// Name of the i-th record which is full of structural characters and escaped
+// quotes to keep the structural index honest.
+std::string recordName(size_t i);
+
+// The i-th record with its id, name and two tags on a single line.
+std::string recordJson(size_t i);
+
+
+/******************************************************************************/
+/* BOX                                                                        */
+/******************************************************************************/
+
+// Holds a T on its own and in an array. StaticBox goes through the static
+// codec and DynamicBox through the dynamic one so that a test templated on the
+// box covers both codecs.
+template<typename T>
+struct StaticBox
+{
+    StaticBox() : id(0), value() {}
+
+    int64_t id;
+    T value;
+    std::vector<T> values;
+};
+
+template<typename T>
+struct DynamicBox : public StaticBox<T> {};
+
+reflectStaticTemplateFields(StaticBox, T, id, value, values)
+
+reflectTemplate(StaticBox, T)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectStatic();
+}
+
+reflectTemplate(DynamicBox, T)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(id);
+    reflectField(value);
+    reflectField(values);
+}
+
+
+/******************************************************************************/
+/* PARALLEL THREADS                                                           */
+/******************************************************************************/
+
+// Overrides the number of threads used to parse arrays for its lifetime.
+struct ParallelThreads
+{
+    explicit ParallelThreads(size_t threads) :
+        original(reflect::json::parallelThreads())
+    {
+        reflect::json::parallelThreads(threads);
+    }
+
+    ~ParallelThreads() { reflect::json::parallelThreads(original); }
+
+    ParallelThreads(const ParallelThreads&) = delete;
+    ParallelThreads& operator=(const ParallelThreads&) = delete;
+
+private:
+    size_t original;
+};
+
+
+/******************************************************************************/
+/* FILES                                                                      */
+/******************************************************************************/
+
+// Content of a file relative to tests/utils/json.
+std::string readFile(const std::string& file);
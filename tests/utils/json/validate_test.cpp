@@ -0,0 +1,162 @@
+/* validate_test.cpp                                 -*- C++ -*-
+   Rémi Attab (remi.attab@gmail.com), 19 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the validation of json without parsing it.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "test_types.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+using namespace reflect::json;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+std::vector<ScanIsa> isas()
+{
+    std::vector<ScanIsa> result;
+    for (ScanIsa isa : { ScanIsa::Scalar, ScanIsa::Sse2, ScanIsa::Avx2 })
+        if (scanSupported(isa)) result.push_back(isa);
+    return result;
+}
+
+// Every kernel must come to the same conclusion.
+void check(const std::string& json, bool valid, Reader::Options options = Reader::Default)
+{
+    ScanIsa original = scanIsa();
+
+    for (ScanIsa isa : isas()) {
+        scanIsa(isa);
+
+        json::Error error = validate(json, options);
+        BOOST_CHECK_MESSAGE(!error == valid,
+                "isa " << unsigned(isa) << " <" << json << ">: " << error.what());
+    }
+
+    scanIsa(original);
+}
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test_valid)
+{
+    check(readFile("generic.json"), true);
+
+    check("null", true);
+    check(" 10 ", true);
+    check("-1.5e10", true);
+    check("\"abc\"", true);
+    check("[]", true);
+    check("{}", true);
+    check("[ [], {}, [ 1, [ 2 ] ], { \"a\": { \"b\": [] } } ]", true);
+    check("{ \"a\": 1, \"b\": [ true, false, null ], \"c\": \"\\u00e9\\n\" }", true);
+    check("\n[ \"\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\" ]\n", true);
+
+    // Structural characters and escaped quotes within strings.
+    check("[ \"]\", \"{:}\", \"a\\\"]\", \"\\\\\" ]", true);
+    check("{ \"[\": \"\\u12aF\", \"b\": -0.5E+3, \"c\": 0e1 }", true);
+}
+
+BOOST_AUTO_TEST_CASE(test_syntax)
+{
+    check("", false);
+    check("   ", false);
+    check("[", false);
+    check("[ 1", false);
+    check("[ 1,", false);
+    check("[ 1, ]", false);
+    check("[ 1 2 ]", false);
+    check("[ 1 }", false);
+    check("{ \"a\" }", false);
+    check("{ \"a\": }", false);
+    check("{ \"a\": 1, }", false);
+    check("{ \"a\" 1 }", false);
+    check("{ 1: 2 }", false);
+    check("{ \"a\": 1 ]", false);
+    check("[ 1 ] [", false);
+    check("1 2", false);
+    check("nul", false);
+    check("[ \"abc ]", false);
+    check("[ \"\\x\" ]", false);
+    check("[ 01x ]", false);
+    check("]", false);
+
+    // Scalars between the structural characters.
+    check("01", false);
+    check("1.", false);
+    check("-", false);
+    check("1e", false);
+    check("1e+", false);
+    check(".5", false);
+    check("tru", false);
+    check("nulll", false);
+    check("\"a\" \"b\"", false);
+    check("[ \"a\" \"b\" ]", false);
+    check("{ \"a\": 1 \"b\": 2 }", false);
+    check("{ \"a\" \"b\": 2 }", false);
+    check("[ \"\\u12g4\" ]", false);
+    check("[ \"\\u12\" ]", false);
+    check("[ \"a\nb\" ]", false);
+    check("[ 1 ]\\", false);
+    check("[ 1, \\[ ]", false);
+}
+
+BOOST_AUTO_TEST_CASE(test_unicode)
+{
+    std::vector<std::string> invalid = {
+        "\xC3", "\xC0\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\x80", "\xFF" };
+
+    for (const std::string& seq : invalid) {
+        std::string json = "[ \"" + std::string(100, 'a') + seq + "\" ]";
+        check(json, false);
+        check(json, true, Reader::None);
+    }
+
+    // Outside of strings it's a syntax error either way.
+    check("[ \xC3\xA9 ]", false, Reader::None);
+}
+
+BOOST_AUTO_TEST_CASE(test_comments)
+{
+    std::string json = "[ 1, // one\n 2 // two\n ]";
+    check(json, false);
+    check(json, true, Reader::Options(Reader::Default | Reader::AllowComments));
+}
+
+BOOST_AUTO_TEST_CASE(test_depth)
+{
+    const size_t depth = 1000 * 1000;
+    std::string json = std::string(depth, '[') + std::string(depth, ']');
+    check(json, true);
+
+    json.pop_back();
+    check(json, false);
+
+    std::string objects;
+    for (size_t i = 0; i < depth; ++i) objects += "{\"a\":";
+    objects += "1" + std::string(depth, '}');
+    check(objects, true);
+}
+
+BOOST_AUTO_TEST_CASE(test_position)
+{
+    json::Error error = validate("[ 1,\n  \"a\xFF\" ]");
+    BOOST_REQUIRE(error);
+    BOOST_CHECK_EQUAL(std::string(error.what()).substr(0, 4), "2:5:");
+
+    error = validate("[ 1,\n  { \"a\": nul } ]");
+    BOOST_REQUIRE(error);
+    BOOST_CHECK_EQUAL(std::string(error.what()).substr(0, 4), "2:10");
+}
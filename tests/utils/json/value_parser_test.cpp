@@ -8,6 +8,8 @@
 #define REFLECT_USE_EXCEPTIONS 1
 
 #include "test_types.h"
+#include "dsl/all.h"
+#include "types/primitives.h"
 #include "types/std/map.h"
 #include "types/std/vector.h"
 #include "types/std/string.h"
@@ -123,3 +125,69 @@ BOOST_AUTO_TEST_CASE(test_value_parser)
     };
     checkObject(obj, onTopField);
 }
+
+
+/******************************************************************************/
+/* TEST DISPATCH                                                              */
+/******************************************************************************/
+
+// Aliases of the same length which only differ in their last byte, one of
+// which isn't the name of its field.
+struct Dispatch
+{
+    Dispatch() : ab(0), ac(0), xy(0), long_(0) {}
+
+    int64_t ab;
+    int64_t ac;
+    int64_t xy;
+    int64_t long_;
+};
+
+reflectType(Dispatch)
+{
+    reflectPlumbing();
+    reflectAlloc();
+    reflectField(ab);
+    reflectField(ac);
+    reflectField(xy);
+    reflectFieldValue(xy, json, json::alias("ad"));
+    reflectField(long_);
+    reflectFieldValue(long_, json, json::alias("long"));
+}
+
+BOOST_AUTO_TEST_CASE(test_dispatch)
+{
+    auto check = [] (const std::string& str, int64_t ab, int64_t ac, int64_t xy, int64_t l) {
+        Dispatch value;
+        json::Error error = parse(str, value);
+        BOOST_CHECK_MESSAGE(!error, str << ": " << error.what());
+
+        BOOST_CHECK_EQUAL(value.ab, ab);
+        BOOST_CHECK_EQUAL(value.ac, ac);
+        BOOST_CHECK_EQUAL(value.xy, xy);
+        BOOST_CHECK_EQUAL(value.long_, l);
+    };
+
+    check("{ \"ab\": 1, \"ac\": 2, \"ad\": 3, \"long\": 4 }", 1, 2, 3, 4);
+    check("{ \"ad\": 3, \"ac\": 2, \"ab\": 1 }", 1, 2, 3, 0);
+
+    // Keys which only match the name of the field or which are longer than
+    // any alias are skipped.
+    check("{ \"xy\": 3, \"long_\": 4, \"abc\": 5, \"longer\": 6 }", 0, 0, 0, 0);
+    check("{ \"ae\": 1, \"aa\": 2, \"b\": 3, \"a\": 4, \"\": 5 }", 0, 0, 0, 0);
+    check("{ \"a-much-longer-key-than-any-alias\": { \"ab\": 1 }, \"ac\": 2 }", 0, 2, 0, 0);
+
+    // Alternating between two key orders leaves every prediction stale on the
+    // next object.
+    for (size_t i = 0; i < 10; ++i) {
+        int64_t n = i;
+        if (i % 2) {
+            check("{ \"ab\": " + std::to_string(n) + ", \"ac\": 1, \"ad\": 2, \"long\": 3 }",
+                    n, 1, 2, 3);
+        }
+        else {
+            check("{ \"long\": 3, \"ad\": " + std::to_string(n) + ", \"ab\": 1, \"zz\": 0, \"ac\": 2 }",
+                    1, 2, n, 3);
+        }
+    }
+}
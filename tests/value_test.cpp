@@ -127,7 +127,7 @@ BOOST_AUTO_TEST_CASE(destruct)
         Value objMove = obj.move();
         (void) objMove;
     }
-    check("obj-move", 2 + 3);
+    check("obj-move", 2 + 2);
 }
 
 
@@ -391,3 +391,138 @@ BOOST_AUTO_TEST_CASE(copyMove)
         BOOST_CHECK_EQUAL(obj.value, 0);
     }
 }
+
+
+/******************************************************************************/
+/* TRY                                                                        */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(tryCast)
+{
+    test::Object o(10);
+    test::Convertible c(o);
+    Value value(c);
+
+    auto ok = value.tryCast<test::Convertible>();
+    BOOST_CHECK(ok);
+    BOOST_CHECK_EQUAL(ok.status(), Status::Ok);
+    BOOST_CHECK_EQUAL(&ok.value(), &c);
+
+    auto fail = value.tryCast<test::Parent>();
+    BOOST_CHECK(!fail);
+    BOOST_CHECK_EQUAL(fail.status(), Status::NotCastable);
+    BOOST_CHECK(!fail.what().empty());
+    BOOST_CHECK_THROW(fail.value(), Error);
+}
+
+BOOST_AUTO_TEST_CASE(tryCall)
+{
+    test::Object o(10);
+    Value value(o);
+
+    auto ok = value.tryCall<Value>("operator+", 5);
+    BOOST_CHECK(ok);
+    BOOST_CHECK_EQUAL(ok.value().field<int>("value"), 15);
+
+    BOOST_CHECK(value.tryCall<void>("operator+=", 2));
+    BOOST_CHECK_EQUAL(o.value, 12);
+
+    auto noFn = value.tryCall<void>("bob");
+    BOOST_CHECK_EQUAL(noFn.status(), Status::NoFunction);
+
+    auto noOverload = value.tryCall<void>("operator+=", test::Parent());
+    BOOST_CHECK_EQUAL(noOverload.status(), Status::NoOverload);
+    BOOST_CHECK_THROW(noOverload.value(), Error);
+
+    // The diagnostic must match the one raised by call.
+    std::string what;
+    try { value.call<void>("operator+=", test::Parent()); }
+    catch (const Error& error) { what = error.what(); }
+    BOOST_CHECK_NE(what.find(noOverload.what()), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(tryField)
+{
+    test::Child c(test::Object(10), true);
+    Value value(c);
+
+    auto child = value.tryField<int>("childValue");
+    BOOST_CHECK_EQUAL(child.status(), Status::NotCastable);
+
+    auto field = value.tryField("childValue");
+    BOOST_CHECK(field);
+    BOOST_CHECK_EQUAL(field.value().field<int>("value"), 10);
+
+    auto object = value.tryField<test::Object&>("childValue");
+    BOOST_CHECK(object);
+    BOOST_CHECK_EQUAL(&object.value(), &c.childValue);
+
+    auto missing = value.tryField("bob");
+    BOOST_CHECK_EQUAL(missing.status(), Status::NoField);
+    BOOST_CHECK(!missing.what().empty());
+}
+
+
+/******************************************************************************/
+/* ARITHMETIC                                                                 */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+    int i = 10;
+    Value value(i);
+    BOOST_CHECK_EQUAL(value.type()->kind(), TypeKind::Int);
+
+    BOOST_CHECK_EQUAL((value + 5).cast<int>(), 15);
+    BOOST_CHECK_EQUAL((value - Value(2.5)).cast<int>(), 8);
+    BOOST_CHECK_EQUAL((value * 2).cast<int>(), 20);
+    BOOST_CHECK_EQUAL((value / 3).cast<int>(), 3);
+    BOOST_CHECK_EQUAL((value % 3).cast<int>(), 1);
+    BOOST_CHECK_EQUAL((value << 1).cast<int>(), 20);
+    BOOST_CHECK_EQUAL((~value).cast<int>(), ~10);
+
+    BOOST_CHECK(value == 10);
+    BOOST_CHECK(value != 11);
+    BOOST_CHECK(value < 10.5f);
+    BOOST_CHECK(value >= Value(10l));
+    BOOST_CHECK(Value(-1) < 1u);
+    BOOST_CHECK(Value(2u) > -1);
+    BOOST_CHECK(value && true);
+    BOOST_CHECK(!(value || 0) == false);
+    BOOST_CHECK((bool) value);
+    BOOST_CHECK(!!value);
+
+    value += 5;
+    BOOST_CHECK_EQUAL(i, 15);
+    value <<= 1;
+    BOOST_CHECK_EQUAL(i, 30);
+
+    ++value;
+    BOOST_CHECK_EQUAL(i, 31);
+    BOOST_CHECK_EQUAL((value++).cast<int>(), 31);
+    BOOST_CHECK_EQUAL(i, 32);
+
+    value.assign(1.5);
+    BOOST_CHECK_EQUAL(i, 1);
+
+    double d = 1.5;
+    Value dValue(d);
+    BOOST_CHECK_EQUAL((dValue * 2).cast<double>(), 3.0);
+    BOOST_CHECK(!dValue.type()->hasFunction(Operator::Mod));
+
+    const int c = 10;
+    Value cValue(c);
+    BOOST_CHECK_EQUAL((cValue + 1).cast<int>(), 11);
+    BOOST_CHECK(cValue == 10);
+}
+
+BOOST_AUTO_TEST_CASE(operators)
+{
+    test::Object o(10);
+    Value value(o);
+
+    value += 5;
+    BOOST_CHECK_EQUAL(o.value, 15);
+    BOOST_CHECK_EQUAL((value + 1).field<int>("value"), 16);
+    BOOST_CHECK(value == test::Object(15));
+}